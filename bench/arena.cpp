@@ -0,0 +1,132 @@
+#include "bench.h"
+#include "chess/game.h"
+#include "chess/dcgencoder.h"
+#include "chess/dcgdecoder.h"
+#include "chess/pgn_printer.h"
+#include <QElapsedTimer>
+#include <iostream>
+
+namespace {
+
+// number of generated games, and their length
+const int ARENA_GAMES = 20;
+const int ARENA_PLIES = 100;
+
+// deterministic choice of moves, so that runs are comparable
+quint32 seed = 7;
+
+bool pickMove(chess::Board *b, chess::Move *m) {
+    chess::Moves *moves = b->legal_moves();
+    bool found = !moves->isEmpty();
+    if(found) {
+        seed = seed * 1103515245 + 12345;
+        *m = moves->at(int((seed >> 16) % quint32(moves->size())));
+    }
+    delete moves;
+    return found;
+}
+
+// a main line of up to ARENA_PLIES plies with a variation of five
+// plies every tenth ply, some nags and comments
+chess::Game* randomGame() {
+    chess::Game *g = new chess::Game();
+    chess::Move m;
+    for(int ply=0;ply<ARENA_PLIES;ply++) {
+        chess::GameNode *current = g->getCurrentNode();
+        if(ply > 2 && ply % 10 == 0) {
+            for(int i=0;i<5 && pickMove(g->getCurrentNode()->getBoard(), &m);i++) {
+                g->applyMove(new chess::Move(m));
+            }
+            g->setCurrent(current);
+        }
+        if(!pickMove(current->getBoard(), &m)) {
+            break;
+        }
+        g->applyMove(new chess::Move(m));
+        // keep the main line first
+        while(current->getVariations()->indexOf(g->getCurrentNode()) > 0) {
+            g->moveUp(g->getCurrentNode());
+        }
+        if(ply % 7 == 0) {
+            g->getCurrentNode()->addNag(1);
+        }
+        if(ply % 13 == 0) {
+            QString comment("comment");
+            g->getCurrentNode()->setComment(comment);
+        }
+    }
+    return g;
+}
+
+}
+
+int arena(const QStringList &args) {
+    int iterations = args.size() > 0 ? args.at(0).toInt() : 500;
+
+    chess::DcgEncoder encoder;
+    chess::DcgDecoder decoder;
+    QList<QByteArray> records;
+    for(int i=0;i<ARENA_GAMES;i++) {
+        chess::Game *g = randomGame();
+        QByteArray record;
+        encoder.encodeGame(g, &record);
+        size_t idx = 0;
+        decoder.decodeLength(reinterpret_cast<const uint8_t*>(record.constData()), size_t(record.size()), &idx);
+        records.append(record.mid(int(idx)));
+        delete g;
+    }
+
+    // decode all records, then free all games: on the heap, on the
+    // heap with the board checkpoints of arena games, and in an arena
+    const char *names[3] = { "heap            ", "heap checkpoints", "arena           " };
+    for(int mode=0;mode<3;mode++) {
+        qint64 decodeNs = 0;
+        qint64 freeNs = 0;
+        for(int i=0;i<iterations;i++) {
+            QList<chess::Game*> games;
+            QElapsedTimer timer;
+            timer.start();
+            for(int j=0;j<records.size();j++) {
+                chess::Game *g = new chess::Game(mode == 2);
+                if(mode == 1) {
+                    g->setBoardCheckpoints(chess::ARENA_BOARD_CHECKPOINTS);
+                }
+                decoder.decodeGame(g, reinterpret_cast<const uint8_t*>(records.at(j).constData()),
+                                   size_t(records.at(j).size()));
+                games.append(g);
+            }
+            decodeNs += timer.nsecsElapsed();
+            timer.restart();
+            for(int j=0;j<games.size();j++) {
+                delete games.at(j);
+            }
+            freeNs += timer.nsecsElapsed();
+        }
+        double n = double(iterations) * records.size();
+        std::cout << names[mode] << " decode " << decodeNs / n / 1000.0
+                  << " us/game, free " << freeNs / n / 1000.0 << " us/game" << std::endl;
+    }
+
+    // both must give the same game
+    chess::PgnPrinter printer;
+    int mismatches = 0;
+    for(int j=0;j<records.size();j++) {
+        chess::Game heap(false);
+        chess::Game arena(true);
+        const uint8_t *data = reinterpret_cast<const uint8_t*>(records.at(j).constData());
+        decoder.decodeGame(&heap, data, size_t(records.at(j).size()));
+        decoder.decodeGame(&arena, data, size_t(records.at(j).size()));
+        QByteArray a;
+        QByteArray b;
+        printer.printGame(&heap, &a);
+        printer.printGame(&arena, &b);
+        if(a != b) {
+            mismatches++;
+        }
+    }
+    if(mismatches > 0) {
+        std::cerr << "Error: " << mismatches << " games differ between heap and arena." << std::endl;
+        return 1;
+    }
+    return 0;
+}
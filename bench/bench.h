@@ -0,0 +1,48 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <QStringList>
+
+namespace chess {
+class Board;
+}
+
+// benchmarks and stress tests of the chess classes. each takes the
+// arguments after its name and returns the exit code of the program
+
+// the usual perft test positions
+const int BENCH_POSITIONS = 5;
+extern const char *const BENCH_FENS[BENCH_POSITIONS];
+// leaves of their perft trees at depth 1 .. BENCH_PERFT_DEPTH
+const int BENCH_PERFT_DEPTH = 5;
+extern const qint64 BENCH_PERFT[BENCH_POSITIONS][BENCH_PERFT_DEPTH];
+
+// number of leaves of the tree of legal moves of depth plies below b
+qint64 countLeaves(chess::Board *b, int depth);
+
+// parses a PGN file and round trips its games through the .dcg
+// encoding on many threads at once. fails on duplicate node ids or
+// games that don't survive the round trip
+int stress(const QStringList &args);
+
+// looks up games of one database on 1, 2, 4, ... threads and reports
+// the games per second of getGameAt() and getFlatGameAt() for each
+int readers(const QStringList &args);
+
+// decodes and frees games of 100 plies with variations, with the
+// nodes on the heap (with and without board checkpoints) and in an arena
+int arena(const QStringList &args);
+
+// parses and writes the fens of the positions up to two plies
+// after BENCH_FENS, as bytes and as QStrings
+int fen(const QStringList &args);
+
+// perft and move generation on BENCH_FENS, and the cost per ply
+// of importing a PGN file and of decoding and printing a database
+int movegen(const QStringList &args);
+
+// checks the perft counts of BENCH_FENS, by default to depth 5/4/5/4/4,
+// or to the given depth. fails if any count differs
+int perft(const QStringList &args);
+
+#endif // BENCH_H
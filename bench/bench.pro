@@ -0,0 +1,74 @@
+# benchmarks and stress tests of the chess classes, see main.cpp.
+# built separately from pgn2dcg: qmake bench/bench.pro
+
+QT += core
+QT += gui
+
+CONFIG += c++11
+
+TARGET = pgn2dcg-bench
+CONFIG += console
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ..
+
+SOURCES += main.cpp \
+    stress.cpp \
+    readers.cpp \
+    arena.cpp \
+    fen.cpp \
+    movegen.cpp \
+    perft.cpp \
+    ../chess/board.cpp \
+    ../chess/ecocode.cpp \
+    ../chess/game.cpp \
+    ../chess/game_node.cpp \
+    ../chess/gui_printer.cpp \
+    ../chess/move.cpp \
+    ../chess/pgn_printer.cpp \
+    ../chess/pgn_reader.cpp \
+    ../chess/polyglot.cpp \
+    ../chess/namebase.cpp \
+    ../chess/sitebase.cpp \
+    ../chess/database.cpp \
+    ../chess/dcgencoder.cpp \
+    ../chess/byteutil.cpp \
+    ../chess/dcgdecoder.cpp \
+    ../chess/indexentry.cpp \
+    ../chess/pgn_transcoder.cpp \
+    ../chess/arena.cpp \
+    ../chess/flat_game.cpp \
+    ../chess/gamecursor.cpp \
+    ../chess/batchfetch.cpp \
+    ../chess/importjournal.cpp \
+    ../chess/pgn_exporter.cpp \
+    ../chess/ecoreclassifier.cpp
+
+HEADERS += bench.h \
+    ../chess/board.h \
+    ../chess/board_tables.h \
+    ../chess/ecocode.h \
+    ../chess/game.h \
+    ../chess/game_node.h \
+    ../chess/gui_printer.h \
+    ../chess/move.h \
+    ../chess/pgn_printer.h \
+    ../chess/pgn_reader.h \
+    ../chess/polyglot.h \
+    ../chess/namebase.h \
+    ../chess/sitebase.h \
+    ../chess/database.h \
+    ../chess/dcgencoder.h \
+    ../chess/byteutil.h \
+    ../chess/dcgdecoder.h \
+    ../chess/indexentry.h \
+    ../chess/pgn_transcoder.h \
+    ../chess/arena.h \
+    ../chess/flat_game.h \
+    ../chess/gamecursor.h \
+    ../chess/batchfetch.h \
+    ../chess/importjournal.h \
+    ../chess/pgn_exporter.h \
+    ../chess/ecoreclassifier.h
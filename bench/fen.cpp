@@ -0,0 +1,91 @@
+#include "bench.h"
+#include "chess/board.h"
+#include <QElapsedTimer>
+#include <QVector>
+#include <iostream>
+
+namespace {
+
+// the fens of all positions of the tree below b up to depth plies
+void collectFens(chess::Board *b, int depth, QVector<QByteArray> *fens) {
+    char fen[chess::FEN_MAX_LENGTH];
+    fens->append(QByteArray(fen, b->fen(fen)));
+    if(depth == 0) {
+        return;
+    }
+    chess::Moves *moves = b->legal_moves();
+    for(int i=0;i<moves->size();i++) {
+        b->make(moves->at(i));
+        collectFens(b, depth - 1, fens);
+        b->unmake();
+    }
+    delete moves;
+}
+
+}
+
+int fen(const QStringList &args) {
+    int iterations = args.size() > 0 ? args.at(0).toInt() : 20;
+
+    QVector<QByteArray> fens;
+    for(int i=0;i<BENCH_POSITIONS;i++) {
+        QString fen(BENCH_FENS[i]);
+        chess::Board b(fen);
+        collectFens(&b, 2, &fens);
+    }
+    QVector<QString> strings;
+    for(int i=0;i<fens.size();i++) {
+        strings.append(QString::fromLatin1(fens.at(i)));
+    }
+
+    // parsing a fen and writing it again must give the same fen
+    int mismatches = 0;
+    char out[chess::FEN_MAX_LENGTH];
+    for(int i=0;i<fens.size();i++) {
+        chess::Board b(fens.at(i).constData(), fens.at(i).size());
+        if(QByteArray(out, b.fen(out)) != fens.at(i) || b.fen() != strings.at(i)) {
+            mismatches++;
+        }
+    }
+
+    qint64 parseBytes = 0;
+    qint64 parseString = 0;
+    qint64 writeBytes = 0;
+    qint64 writeString = 0;
+    chess::Board board(true);
+    int written = 0;
+    for(int k=0;k<iterations;k++) {
+        QElapsedTimer timer;
+        timer.start();
+        for(int i=0;i<fens.size();i++) {
+            chess::Board b(fens.at(i).constData(), fens.at(i).size());
+        }
+        parseBytes += timer.nsecsElapsed();
+        timer.restart();
+        for(int i=0;i<strings.size();i++) {
+            chess::Board b(strings.at(i));
+        }
+        parseString += timer.nsecsElapsed();
+        timer.restart();
+        for(int i=0;i<fens.size();i++) {
+            written += board.fen(out);
+        }
+        writeBytes += timer.nsecsElapsed();
+        timer.restart();
+        for(int i=0;i<fens.size();i++) {
+            written += board.fen().size();
+        }
+        writeString += timer.nsecsElapsed();
+    }
+    double n = double(iterations) * fens.size();
+    std::cout << fens.size() << " positions, " << written << " bytes written" << std::endl;
+    std::cout << "Board(const char*, int) " << parseBytes / n << " ns" << std::endl;
+    std::cout << "Board(const QString&)   " << parseString / n << " ns" << std::endl;
+    std::cout << "fen(char*)              " << writeBytes / n << " ns" << std::endl;
+    std::cout << "fen()                   " << writeString / n << " ns" << std::endl;
+    if(mismatches > 0) {
+        std::cerr << "Error: " << mismatches << " fens changed when parsed and written." << std::endl;
+        return 1;
+    }
+    return 0;
+}
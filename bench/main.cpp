@@ -0,0 +1,46 @@
+#include <QCoreApplication>
+#include <iostream>
+#include "bench.h"
+
+const char *const BENCH_FENS[BENCH_POSITIONS] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"
+};
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QStringList args = app.arguments();
+    QString name = args.size() > 1 ? args.at(1) : QString();
+    args = args.mid(2);
+    if(name == "stress") {
+        return stress(args);
+    }
+    if(name == "readers") {
+        return readers(args);
+    }
+    if(name == "arena") {
+        return arena(args);
+    }
+    if(name == "fen") {
+        return fen(args);
+    }
+    if(name == "movegen") {
+        return movegen(args);
+    }
+    if(name == "perft") {
+        return perft(args);
+    }
+    std::cerr << "usage: pgn2dcg-bench <benchmark> [arguments]\n\n"
+                 "  stress games.pgn [threads]\n"
+                 "  readers database.dcg [lookups per thread] [max threads]\n"
+                 "  arena [iterations]\n"
+                 "  fen [iterations]\n"
+                 "  movegen [games.pgn] [database.dcg]\n"
+                 "  perft [depth]" << std::endl;
+    return 1;
+}
@@ -0,0 +1,161 @@
+#include "bench.h"
+#include "chess/board.h"
+#include "chess/database.h"
+#include "chess/pgn_reader.h"
+#include "chess/pgn_transcoder.h"
+#include "chess/pgn_printer.h"
+#include "chess/dcgdecoder.h"
+#include <QElapsedTimer>
+#include <iostream>
+
+namespace {
+
+// minimum over this many runs, to be robust against noise
+const int MOVEGEN_RUNS = 10;
+
+// returns false if a perft count is wrong
+bool timePerft() {
+    const int depths[BENCH_POSITIONS] = { 3, 2, 3, 2, 2 };
+    qint64 best = -1;
+    qint64 leaves = 0;
+    bool ok = true;
+    for(int r=0;r<MOVEGEN_RUNS;r++) {
+        QElapsedTimer timer;
+        timer.start();
+        leaves = 0;
+        for(int i=0;i<BENCH_POSITIONS;i++) {
+            QString fen(BENCH_FENS[i]);
+            chess::Board b(fen);
+            qint64 n = countLeaves(&b, depths[i]);
+            ok = ok && n == BENCH_PERFT[i][depths[i]-1];
+            leaves += n;
+        }
+        qint64 ns = timer.nsecsElapsed();
+        if(best < 0 || ns < best) {
+            best = ns;
+        }
+    }
+    std::cout << "perft: " << leaves << " leaves, " << double(best) / leaves << " ns/leaf" << std::endl;
+    if(!ok) {
+        std::cerr << "Error: perft counts differ, cf. pgn2dcg-bench perft." << std::endl;
+    }
+    return ok;
+}
+
+void timeMoves() {
+    QString fen(BENCH_FENS[1]);
+    chess::Board b(fen);
+    const int calls = 10000;
+    for(int legal=0;legal<2;legal++) {
+        qint64 best = -1;
+        for(int r=0;r<MOVEGEN_RUNS;r++) {
+            QElapsedTimer timer;
+            timer.start();
+            for(int i=0;i<calls;i++) {
+                delete (legal == 1 ? b.legal_moves() : b.pseudo_legal_moves());
+            }
+            qint64 ns = timer.nsecsElapsed();
+            if(best < 0 || ns < best) {
+                best = ns;
+            }
+        }
+        std::cout << (legal == 1 ? "legal_moves:        " : "pseudo_legal_moves: ")
+                  << double(best) / calls << " ns" << std::endl;
+    }
+}
+
+// transcodes all games of a PGN file, i.e. parses and
+// replays their moves as on import
+void timeImport(const QString &filename) {
+    chess::PgnReader reader;
+    const char *encoding = reader.detect_encoding(filename);
+    QList<chess::HeaderOffset*> *headers = reader.scan_headers(filename, encoding);
+    QList<qint64> offsets;
+    for(int i=0;i<headers->size();i++) {
+        offsets.append(headers->at(i)->offset);
+        delete headers->at(i)->headers;
+        delete headers->at(i);
+    }
+    delete headers;
+
+    chess::PgnTranscoder transcoder;
+    QByteArray records;
+    QElapsedTimer timer;
+    timer.start();
+    for(int i=0;i<offsets.size();i++) {
+        try {
+            transcoder.transcodeGameFromFile(filename, encoding, offsets.at(i), &records);
+        } catch(std::invalid_argument a) {
+            continue;
+        }
+    }
+    qint64 ns = timer.nsecsElapsed();
+
+    // count the plies of the records, not timed
+    chess::DcgDecoder decoder;
+    chess::FlatGame g;
+    qint64 plies = 0;
+    const uint8_t *data = reinterpret_cast<const uint8_t*>(records.constData());
+    size_t idx = 0;
+    while(idx < size_t(records.size())) {
+        size_t length = decoder.decodeLength(data, size_t(records.size()), &idx);
+        g.clear();
+        decoder.decodeGame(&g, data + idx, length);
+        plies += g.size() - 1;
+        idx += length;
+    }
+    std::cout << "import: " << offsets.size() << " games, " << plies << " plies, "
+              << double(ns) / (plies > 0 ? plies : 1) << " ns/ply" << std::endl;
+}
+
+// decodes games of a database and prints them as PGN
+void timeDecode(QString filename) {
+    if(filename.endsWith(".dcg") || filename.endsWith(".dci")) {
+        filename = filename.left(filename.size()-4);
+    }
+    chess::Database db(filename);
+    db.loadIndex();
+    db.loadNames();
+    db.loadSites();
+    db.loadEvents();
+    db.setGameCacheSize(0);
+    int n = db.countGames() < 2000 ? db.countGames() : 2000;
+    chess::PgnPrinter printer;
+    chess::FlatGame g;
+    QByteArray out;
+    qint64 best = -1;
+    qint64 plies = 0;
+    for(int r=0;r<MOVEGEN_RUNS;r++) {
+        QElapsedTimer timer;
+        timer.start();
+        plies = 0;
+        for(int i=0;i<n;i++) {
+            if(db.getFlatGameAt(i, &g) == 0) {
+                continue;
+            }
+            out.resize(0);
+            printer.printGame(&g, &out);
+            plies += g.size() - 1;
+        }
+        qint64 ns = timer.nsecsElapsed();
+        if(best < 0 || ns < best) {
+            best = ns;
+        }
+    }
+    std::cout << "decode + print: " << n << " games, " << plies << " plies, "
+              << double(best) / (plies > 0 ? plies : 1) << " ns/ply" << std::endl;
+}
+
+}
+
+int movegen(const QStringList &args) {
+    bool ok = timePerft();
+    timeMoves();
+    if(args.size() > 0 && !args.at(0).isEmpty()) {
+        timeImport(args.at(0));
+    }
+    if(args.size() > 1) {
+        timeDecode(args.at(1));
+    }
+    return ok ? 0 : 1;
+}
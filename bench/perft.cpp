@@ -0,0 +1,61 @@
+#include "bench.h"
+#include "chess/board.h"
+#include <QElapsedTimer>
+#include <iostream>
+
+const qint64 BENCH_PERFT[BENCH_POSITIONS][BENCH_PERFT_DEPTH] = {
+    { 20, 400, 8902, 197281, 4865609 },
+    { 48, 2039, 97862, 4085603, 193690690 },
+    { 14, 191, 2812, 43238, 674624 },
+    { 6, 264, 9467, 422333, 15833292 },
+    { 44, 1486, 62379, 2103487, 89941194 }
+};
+
+qint64 countLeaves(chess::Board *b, int depth) {
+    if(depth == 0) {
+        return 1;
+    }
+    qint64 leaves = 0;
+    chess::Moves *moves = b->legal_moves();
+    for(int i=0;i<moves->size();i++) {
+        b->make(moves->at(i));
+        leaves += countLeaves(b, depth - 1);
+        b->unmake();
+    }
+    delete moves;
+    return leaves;
+}
+
+int perft(const QStringList &args) {
+    // deep enough to reach promotions, castling and e.p. in all
+    // positions, and still done in seconds
+    const int depths[BENCH_POSITIONS] = { 5, 4, 5, 4, 4 };
+    int maxDepth = args.size() > 0 ? args.at(0).toInt() : 0;
+    if(maxDepth > BENCH_PERFT_DEPTH) {
+        maxDepth = BENCH_PERFT_DEPTH;
+    }
+    int mismatches = 0;
+    for(int i=0;i<BENCH_POSITIONS;i++) {
+        QString fen(BENCH_FENS[i]);
+        int depth = maxDepth > 0 ? maxDepth : depths[i];
+        for(int d=1;d<=depth;d++) {
+            chess::Board b(fen);
+            QElapsedTimer timer;
+            timer.start();
+            qint64 leaves = countLeaves(&b, d);
+            qint64 ms = timer.elapsed();
+            bool ok = leaves == BENCH_PERFT[i][d-1];
+            std::cout << "position " << i + 1 << " depth " << d << ": " << leaves << " leaves";
+            if(!ok) {
+                std::cout << ", expected " << BENCH_PERFT[i][d-1] << " MISMATCH";
+                mismatches++;
+            }
+            std::cout << " (" << ms << " ms)" << std::endl;
+        }
+    }
+    if(mismatches > 0) {
+        std::cerr << "Error: " << mismatches << " perft counts differ." << std::endl;
+        return 1;
+    }
+    return 0;
+}
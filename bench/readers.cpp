@@ -0,0 +1,113 @@
+#include "bench.h"
+#include "chess/database.h"
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
+#include <iostream>
+
+namespace {
+
+// looks up games of a database shared by all tasks, each task
+// in its own order so that they don't read the same records
+class ReaderTask : public QRunnable
+{
+public:
+    ReaderTask(chess::Database *db, int task, int lookups, bool flat) {
+        this->db = db;
+        this->task = task;
+        this->lookups = lookups;
+        this->flat = flat;
+        this->errors = 0;
+        this->setAutoDelete(false);
+    }
+
+    void run() {
+        int n = this->db->countGames();
+        chess::FlatGame flatGame;
+        for(int i=0;i<this->lookups;i++) {
+            int id = int((qint64(i) * 7919 + qint64(this->task) * 104729) % n);
+            if(this->flat) {
+                if(this->db->getFlatGameAt(id, &flatGame) == 0) {
+                    this->errors++;
+                }
+            } else {
+                chess::Game *g = this->db->getGameAt(id);
+                if(g == 0) {
+                    this->errors++;
+                }
+                delete g;
+            }
+        }
+    }
+
+    int errors;
+
+private:
+    chess::Database *db;
+    int task;
+    int lookups;
+    bool flat;
+};
+
+}
+
+int readers(const QStringList &args) {
+    if(args.isEmpty()) {
+        std::cerr << "Error: no database given." << std::endl;
+        return 1;
+    }
+    QString filename = args.at(0);
+    if(filename.endsWith(".dcg") || filename.endsWith(".dci")) {
+        filename = filename.left(filename.size()-4);
+    }
+    int lookups = args.size() > 1 ? args.at(1).toInt() : 2000;
+    int maxThreads = args.size() > 2 ? args.at(2).toInt() : 16;
+
+    chess::Database db(filename);
+    db.loadIndex();
+    db.loadNames();
+    db.loadSites();
+    db.loadEvents();
+    if(db.countGames() == 0) {
+        std::cerr << "Error: database has no games." << std::endl;
+        return 1;
+    }
+    // every lookup decodes its game
+    db.setGameCacheSize(0);
+
+    std::cout << "cores: " << QThread::idealThreadCount() << ", lookups per thread: " << lookups << std::endl;
+    int errors = 0;
+    for(int flat=0;flat<2;flat++) {
+        double single = 0;
+        for(int threads=1;threads<=maxThreads;threads*=2) {
+            QElapsedTimer timer;
+            timer.start();
+            QThreadPool pool;
+            pool.setMaxThreadCount(threads);
+            QList<ReaderTask*> tasks;
+            for(int i=0;i<threads;i++) {
+                ReaderTask *task = new ReaderTask(&db, i, lookups, flat == 1);
+                tasks.append(task);
+                pool.start(task);
+            }
+            pool.waitForDone();
+            qint64 ns = timer.nsecsElapsed();
+            for(int i=0;i<tasks.size();i++) {
+                errors += tasks.at(i)->errors;
+                delete tasks.at(i);
+            }
+            double rate = double(threads) * lookups * 1e9 / double(ns > 0 ? ns : 1);
+            if(threads == 1) {
+                single = rate;
+            }
+            std::cout << (flat == 1 ? "getFlatGameAt" : "getGameAt    ") << " threads " << threads
+                      << ": " << qint64(rate) << " games/s, speedup " << rate / single << std::endl;
+        }
+    }
+    if(errors > 0) {
+        std::cerr << "Error: " << errors << " lookups failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include "bench.h"
+#include "chess/pgn_reader.h"
+#include "chess/dcgencoder.h"
+#include "chess/dcgdecoder.h"
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QSet>
+#include <iostream>
+
+namespace {
+
+void collectIds(chess::GameNode *node, QVector<int> *ids) {
+    ids->append(node->getId());
+    for(int i=0;i<node->getVariations()->size();i++) {
+        collectIds(node->getVariation(i), ids);
+    }
+}
+
+// reads all games with its own reader, encoder and decoder, and
+// records the ids of the nodes of the read and the decoded games
+class StressTask : public QRunnable
+{
+public:
+    StressTask(const QString &filename, const char *encoding, const QVector<qint64> *offsets) {
+        this->filename = filename;
+        this->encoding = encoding;
+        this->offsets = offsets;
+        this->mismatches = 0;
+        this->errors = 0;
+        this->setAutoDelete(false);
+    }
+
+    void run() {
+        chess::PgnReader reader;
+        chess::DcgEncoder encoder;
+        chess::DcgDecoder decoder;
+        for(int i=0;i<this->offsets->size();i++) {
+            chess::Game *g = reader.readGameFromFile(this->filename, this->encoding, this->offsets->at(i));
+            chess::Game *h = new chess::Game();
+            QByteArray record;
+            encoder.encodeGame(g, &record);
+            try {
+                const uint8_t *data = reinterpret_cast<const uint8_t*>(record.constData());
+                size_t idx = 0;
+                size_t length = decoder.decodeLength(data, size_t(record.size()), &idx);
+                decoder.decodeGame(h, data + idx, length);
+                QByteArray again;
+                encoder.encodeGame(h, &again);
+                if(again != record) {
+                    this->mismatches++;
+                }
+            } catch(std::invalid_argument a) {
+                this->errors++;
+            }
+            collectIds(g->getRootNode(), &this->ids);
+            collectIds(h->getRootNode(), &this->ids);
+            delete g;
+            delete h;
+        }
+    }
+
+    QVector<int> ids;
+    int mismatches;
+    int errors;
+
+private:
+    QString filename;
+    const char *encoding;
+    const QVector<qint64> *offsets;
+};
+
+}
+
+int stress(const QStringList &args) {
+    if(args.isEmpty()) {
+        std::cerr << "Error: no PGN file given." << std::endl;
+        return 1;
+    }
+    QString filename = args.at(0);
+    int threads = args.size() > 1 ? args.at(1).toInt() : 16;
+    if(threads < 1) {
+        threads = 1;
+    }
+
+    chess::PgnReader reader;
+    const char *encoding = reader.detect_encoding(filename);
+    QList<chess::HeaderOffset*> *headers = reader.scan_headers(filename, encoding);
+    QVector<qint64> offsets;
+    for(int i=0;i<headers->size();i++) {
+        offsets.append(headers->at(i)->offset);
+        delete headers->at(i)->headers;
+        delete headers->at(i);
+    }
+    delete headers;
+
+    // all threads read the same games at the same time
+    QElapsedTimer timer;
+    timer.start();
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    QList<StressTask*> tasks;
+    for(int i=0;i<threads;i++) {
+        StressTask *task = new StressTask(filename, encoding, &offsets);
+        tasks.append(task);
+        pool.start(task);
+    }
+    pool.waitForDone();
+    qint64 ms = timer.elapsed();
+
+    QSet<int> ids;
+    int nodes = 0;
+    int mismatches = 0;
+    int errors = 0;
+    for(int i=0;i<tasks.size();i++) {
+        StressTask *task = tasks.at(i);
+        for(int j=0;j<task->ids.size();j++) {
+            ids.insert(task->ids.at(j));
+        }
+        nodes += task->ids.size();
+        mismatches += task->mismatches;
+        errors += task->errors;
+        delete task;
+    }
+    int duplicates = nodes - ids.size();
+    std::cout << threads << " threads, " << threads * offsets.size() << " games, "
+              << nodes << " nodes in " << ms << " ms: " << duplicates << " duplicate ids, "
+              << mismatches << " mismatches, " << errors << " decoding errors" << std::endl;
+    return duplicates == 0 && mismatches == 0 && errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#include "arena.h"
+#include <stdlib.h>
+
+namespace chess {
+
+// all allocations are rounded up to this
+const size_t ARENA_ALIGN = 16;
+
+Arena::Arena(size_t blockSize)
+{
+    this->blocks = new QList<char*>();
+    this->blockSize = blockSize;
+    this->pos = 0;
+    this->end = 0;
+    this->reserved = 0;
+    this->used = 0;
+    this->cleanups = 0;
+}
+
+Arena::~Arena()
+{
+    // cleanups were pushed to the front, so this
+    // destroys objects in reverse order of creation
+    Cleanup *c = this->cleanups;
+    while(c != 0) {
+        c->fn(c->obj);
+        c = c->next;
+    }
+    for(int i=0;i<this->blocks->size();i++) {
+        free(this->blocks->at(i));
+    }
+    delete this->blocks;
+}
+
+void* Arena::allocate(size_t size) {
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if(this->pos == 0 || size_t(this->end - this->pos) < size) {
+        // start a new block. oversized requests get a block of their own
+        size_t n = size > this->blockSize ? size : this->blockSize;
+        char *block = static_cast<char*>(malloc(n));
+        if(block == 0) {
+            throw std::bad_alloc();
+        }
+        this->blocks->append(block);
+        this->reserved += n;
+        this->pos = block;
+        this->end = block + n;
+    }
+    void *p = this->pos;
+    this->pos += size;
+    this->used += size;
+    return p;
+}
+
+void Arena::addCleanup(void *obj, void (*fn)(void*)) {
+    Cleanup *c = static_cast<Cleanup*>(this->allocate(sizeof(Cleanup)));
+    c->obj = obj;
+    c->fn = fn;
+    c->next = this->cleanups;
+    this->cleanups = c;
+}
+
+size_t Arena::bytesReserved() {
+    return this->reserved;
+}
+
+size_t Arena::bytesUsed() {
+    return this->used;
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <QList>
+#include <stddef.h>
+#include <new>
+#include <type_traits>
+
+namespace chess {
+
+const size_t ARENA_BLOCK_SIZE = 64 * 1024;
+
+// bump allocator for objects that live and die together, i.e. all
+// nodes, boards and moves of one game. memory is taken from large
+// blocks and only released when the arena is destroyed. objects
+// created with make() that have a non-trivial destructor have it run
+// at that time (in reverse order of creation), so that members like
+// QList or QString release their data. the destructors run as one
+// linear pass over a list that lives in the arena itself; no object
+// is freed individually. trivially destructible objects (e.g. Move)
+// cost nothing on destruction
+class Arena
+{
+public:
+    Arena(size_t blockSize = ARENA_BLOCK_SIZE);
+    ~Arena();
+
+    // returns size bytes of memory aligned to 16 byte
+    void* allocate(size_t size);
+
+    // constructs an object of type T in the arena and registers its
+    // destructor, unless it is trivial. the object must not be deleted
+    template<typename T, typename... Args>
+    T* make(Args&&... args) {
+        void *p = this->allocate(sizeof(T));
+        T* obj = new (p) T(static_cast<Args&&>(args)...);
+        if(!std::is_trivially_destructible<T>::value) {
+            this->addCleanup(obj, &Arena::destroy<T>);
+        }
+        return obj;
+    }
+
+    // hands a heap allocated object over to the arena,
+    // it is deleted when the arena is destroyed
+    template<typename T>
+    T* adopt(T *obj) {
+        this->addCleanup(obj, &Arena::release<T>);
+        return obj;
+    }
+
+    // total number of bytes of all blocks
+    size_t bytesReserved();
+    // number of bytes handed out so far
+    size_t bytesUsed();
+
+private:
+    struct Cleanup {
+        void *obj;
+        void (*fn)(void*);
+        Cleanup *next;
+    };
+
+    template<typename T>
+    static void destroy(void *obj) {
+        static_cast<T*>(obj)->~T();
+    }
+
+    template<typename T>
+    static void release(void *obj) {
+        delete static_cast<T*>(obj);
+    }
+
+    void addCleanup(void *obj, void (*fn)(void*));
+
+    QList<char*> *blocks;
+    size_t blockSize;
+    char *pos;
+    char *end;
+    size_t reserved;
+    size_t used;
+    Cleanup *cleanups;
+};
+
+}
+
+#endif // ARENA_H
@@ -0,0 +1,89 @@
+#include "batchfetch.h"
+#include "chess/database.h"
+#include "chess/dcgdecoder.h"
+#include <QFile>
+#include <QByteArray>
+#include <iostream>
+
+namespace chess {
+
+BatchFetchTask::BatchFetchTask(Database *db, QVector<BatchItem> *items, QVector<BatchRead> *reads,
+                               int first, int last, int boardCheckpoints,
+                               QVector<Game*> *games, QVector<FlatGame*> *flatGames)
+{
+    this->db = db;
+    this->items = items;
+    this->reads = reads;
+    this->first = first;
+    this->last = last;
+    this->boardCheckpoints = boardCheckpoints;
+    this->games = games;
+    this->flatGames = flatGames;
+}
+
+void BatchFetchTask::run() {
+    // a handle of our own, so that seeking doesn't
+    // interfere with the other tasks of the batch
+    QFile gamesFile(this->db->getGamesFilename());
+    if(!gamesFile.open(QFile::ReadOnly)) {
+        std::cerr << "Error: can't open .dcg file." << std::endl;
+        return;
+    }
+    DcgDecoder decoder;
+    QByteArray buffer;
+    for(int r=this->first;r<this->last;r++) {
+        const BatchRead &read = this->reads->at(r);
+        int size = int(read.end - read.start);
+        buffer.resize(size);
+        qint64 n = -1;
+        if(gamesFile.seek(qint64(read.start))) {
+            n = gamesFile.read(buffer.data(), size);
+        }
+        if(n < 0) {
+            continue;
+        }
+        const uint8_t *data = reinterpret_cast<const uint8_t*>(buffer.constData());
+        for(int j=read.first;j<read.last;j++) {
+            const BatchItem &item = this->items->at(j);
+            size_t start = size_t(item.offset - read.start);
+            size_t available = size_t(item.end - read.start);
+            if(available > size_t(n)) {
+                // the file is shorter than the index claims
+                available = size_t(n);
+            }
+            if(start >= available) {
+                continue;
+            }
+            IndexEntry *ie = this->db->getIndexEntry(item.index);
+            try {
+                size_t idx = start;
+                size_t length = decoder.decodeLength(data, available, &idx);
+                if(this->games != 0) {
+                    Game *g = new Game();
+                    g->setBoardCheckpoints(this->boardCheckpoints);
+                    g->setResult(this->db->readHeaders(ie, g->headers));
+                    // slots are distinct, no two tasks write to the same one
+                    (*this->games)[item.slot] = g;
+                    decoder.decodeGame(g, data + idx, length);
+                } else {
+                    FlatGame *g = new FlatGame();
+                    (*this->flatGames)[item.slot] = g;
+                    decoder.decodeGame(g, data + idx, length);
+                    g->setResult(this->db->readHeaders(ie, g->headers));
+                }
+            } catch(std::invalid_argument a) {
+                std::cerr << a.what() << std::endl;
+                if(this->games != 0) {
+                    delete this->games->at(item.slot);
+                    (*this->games)[item.slot] = 0;
+                } else {
+                    delete this->flatGames->at(item.slot);
+                    (*this->flatGames)[item.slot] = 0;
+                }
+            }
+        }
+    }
+    gamesFile.close();
+}
+
+}
@@ -0,0 +1,65 @@
+#ifndef BATCHFETCH_H
+#define BATCHFETCH_H
+
+#include <QRunnable>
+#include <QVector>
+#include "chess/game.h"
+#include "chess/flat_game.h"
+
+namespace chess {
+
+class Database;
+
+// records closer than this are fetched with the read of their
+// neighbour instead of starting a new read
+const quint64 BATCH_MAX_GAP = 1 << 16;
+// a read is not extended beyond this many bytes
+const quint64 BATCH_MAX_READ = 1 << 22;
+
+// one requested game of a batch
+struct BatchItem {
+    // position in the database and in the request
+    int index;
+    int slot;
+    // record in the .dcg file (including the length prefix),
+    // end is the start of the following record
+    quint64 offset;
+    quint64 end;
+};
+
+// a range of the .dcg file that is fetched with a single read.
+// it covers items first .. last-1 (sorted by offset)
+struct BatchRead {
+    quint64 start;
+    quint64 end;
+    int first;
+    int last;
+};
+
+// fetches the reads first .. last-1 of a batch and decodes the games
+// in them into their slots of either games or flatGames (the other
+// one is 0). each task uses a file handle and decoder of its own, so
+// the tasks of a batch run in parallel on a thread pool. slots of
+// records that can't be read or decoded are left at 0
+class BatchFetchTask : public QRunnable
+{
+public:
+    BatchFetchTask(Database *db, QVector<BatchItem> *items, QVector<BatchRead> *reads,
+                   int first, int last, int boardCheckpoints,
+                   QVector<Game*> *games, QVector<FlatGame*> *flatGames);
+    void run();
+
+private:
+    Database *db;
+    QVector<BatchItem> *items;
+    QVector<BatchRead> *reads;
+    int first;
+    int last;
+    int boardCheckpoints;
+    QVector<Game*> *games;
+    QVector<FlatGame*> *flatGames;
+};
+
+}
+
+#endif // BATCHFETCH_H
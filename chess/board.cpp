@@ -19,15 +19,18 @@
 
 
 #include <QString>
+#include <QByteArray>
 #include <QList>
 #include <QDebug>
 #include <QStringList>
 #include "board.h"
+#include "board_tables.h"
 #include <iostream>
 #include <bitset>
 #include <exception>
 #include <algorithm>
 #include <assert.h>
+#include <string.h>
 #include "move.h"
 
 using namespace std;
@@ -310,16 +313,15 @@ Board::Board() {
     this->turn = WHITE;
     for(int i=0;i<120;i++) {
         this->board[i] = EMPTY_POS[i];
-        this->old_board[i] = 0xFF;
     }
     this->castling_rights = 0;
     this->en_passent_target = 0;
     this->halfmove_clock = 0;
     this->fullmove_number = 1;
     this->undo_available = false;
+    this->undo_depth = 0;
     this->last_was_null = false;
-    this->prev_halfmove_clock = 0;
-    this->transpositionTable = new QMap<quint64, int>();
+    this->transpositionTable = new QVector<quint64>();
     this->update_transposition_table();
 }
 
@@ -335,12 +337,12 @@ Board::Board(Board *b) {
     this->halfmove_clock = 0;
     this->fullmove_number = 1;
     this->undo_available = false;
+    this->undo_depth = 0;
     for(int i=0;i<120;i++) {
         this->board[i] = b->board[i];
     }
     this->last_was_null = false;
-    this->prev_halfmove_clock = 0;
-    this->transpositionTable = new QMap<quint64, int>();
+    this->transpositionTable = new QVector<quint64>();
     this->update_transposition_table();
 }
 
@@ -349,7 +351,6 @@ Board::Board(bool initial_position) {
     if(initial_position) {
         for(int i=0;i<120;i++) {
             this->board[i] = chess::INIT_POS[i];
-            this->old_board[i] = 0xFF;
         }
         this->castling_rights = 0x0F;
     } else {
@@ -362,9 +363,9 @@ Board::Board(bool initial_position) {
     this->halfmove_clock = 0;
     this->fullmove_number = 1;
     this->undo_available = false;
+    this->undo_depth = 0;
     this->last_was_null = false;
-    this->prev_halfmove_clock = 0;
-    this->transpositionTable = new QMap<quint64, int>();
+    this->transpositionTable = new QVector<quint64>();
     this->update_transposition_table();
 }
 
@@ -443,11 +444,29 @@ uint8_t Board::piece_from_symbol(QChar c) {
     return 0x00;
 }
 
+uint8_t Board::piece_from_symbol(char c) {
+    switch(c) {
+    case 'K': return 0x06;
+    case 'Q': return 0x05;
+    case 'R': return 0x04;
+    case 'B': return 0x03;
+    case 'N': return 0x02;
+    case 'P': return 0x01;
+    case 'k': return 0x86;
+    case 'q': return 0x85;
+    case 'r': return 0x84;
+    case 'b': return 0x83;
+    case 'n': return 0x82;
+    case 'p': return 0x81;
+    default: return 0x00;
+    }
+}
+
 void Board::set_piece_at(int x, int y, uint8_t piece) {
     if(x>=0 && x<8 && y>=0 && y <8 &&
             ((piece >= 0x01 && piece <= 0x06) ||
              (piece >= 0x81 && piece <= 0x86) || (piece == 0x00))) {
-        int idx = ((y+2)*10) + (x+1);
+        int idx = SQUARE_AT[x + 8 * y];
         this->board[idx] = piece;
     } else {
         throw std::invalid_argument("called set_piece_at with invalid paramters");
@@ -457,7 +476,7 @@ void Board::set_piece_at(int x, int y, uint8_t piece) {
 
 uint8_t Board::get_piece_at(int x, int y) {
     if(x>=0 && x<8 && y>=0 && y <8) {
-        int idx = ((y+2)*10) + (x+1);
+        int idx = SQUARE_AT[x + 8 * y];
         return this->board[idx];
     } else {
         throw std::invalid_argument("called get_piece_at with invalid paramters");
@@ -466,7 +485,7 @@ uint8_t Board::get_piece_at(int x, int y) {
 
 uint8_t Board::get_piece_type_at(int x, int y) {
     if(x>=0 && x<8 && y>=0 && y <8) {
-        int idx = ((y+2)*10) + (x+1);
+        int idx = SQUARE_AT[x + 8 * y];
         uint8_t piece = this->board[idx];
         if(piece >= 0x80) {
             return piece - 0x80;
@@ -480,7 +499,7 @@ uint8_t Board::get_piece_type_at(int x, int y) {
 
 bool Board::get_piece_color_at(int x, int y) {
     if(x>=0 && x<8 && y>=0 && y <8) {
-        int idx = ((y+2)*10) + (x+1);
+        int idx = SQUARE_AT[x + 8 * y];
         return this->piece_color(idx);
     } else {
         throw std::invalid_argument("called get_piece_color_at with invalid paramters");
@@ -531,164 +550,201 @@ QChar Board::piece_to_symbol(uint8_t piece) {
 }
 
 Board::Board(const QString &fen_string) {
+    QByteArray fen = fen_string.toLatin1();
+    this->init_from_fen(fen.constData(), fen.size());
+}
+
+Board::Board(const char *fen, int len) {
+    this->init_from_fen(fen, len);
+}
+
+// same as QString::toInt(), i.e. 0 if s is not a number
+int Board::fen_number(const char *s, int len) {
+    int i = 0;
+    while(i < len && (s[i] == ' ' || (s[i] >= 0x09 && s[i] <= 0x0d))) {
+        i++;
+    }
+    while(len > i && (s[len-1] == ' ' || (s[len-1] >= 0x09 && s[len-1] <= 0x0d))) {
+        len--;
+    }
+    bool negative = false;
+    if(i < len && (s[i] == '-' || s[i] == '+')) {
+        negative = s[i] == '-';
+        i++;
+    }
+    if(i == len) {
+        return 0;
+    }
+    qint64 value = 0;
+    for(;i<len;i++) {
+        if(s[i] < '0' || s[i] > '9') {
+            return 0;
+        }
+        value = value * 10 + (s[i] - '0');
+        if(value > qint64(2147483648LL)) {
+            return 0;
+        }
+    }
+    if(negative) {
+        value = -value;
+    }
+    if(value > 2147483647LL) {
+        return 0;
+    }
+    return int(value);
+}
+
+void Board::init_from_fen(const char *fen, int len) {
 
     for(int i=0;i<120;i++) {
         this->board[i] = EMPTY_POS[i];
-        this->old_board[i] = 0xFF;
     }
 
     // check that we have six parts in fen, each separated by space
-    QStringList fen_parts = fen_string.split(QChar(' '));
-    if(fen_parts.size() != 6) {
+    int part_start[6];
+    int part_end[6];
+    int parts = 0;
+    int start = 0;
+    for(int i=0;i<=len;i++) {
+        if(i == len || fen[i] == ' ') {
+            if(parts == 6) {
+                throw std::invalid_argument("fen: not 6 fen parts");
+            }
+            part_start[parts] = start;
+            part_end[parts] = i;
+            parts++;
+            start = i + 1;
+        }
+    }
+    if(parts != 6) {
         throw std::invalid_argument("fen: not 6 fen parts");
     }
     // check that the first part consists of 8 rows, each sep. by /
-    QStringList rows = fen_parts.at(0).split(QChar('/'));
-    if(rows.size() != 8) {
+    int rows = 1;
+    for(int i=part_start[0];i<part_end[0];i++) {
+        if(fen[i] == '/') {
+            rows++;
+        }
+    }
+    if(rows != 8) {
         throw std::invalid_argument("fen: not 8 rows in 0th part");
     }
-    // check that in each row, there are no two consecutive digits
-    for(int i=0;i<rows.size();i++) {
-        QString row = rows.at(i);
-        int field_sum = 0;
-        bool previous_was_digit = false;
-        for(int j=0;j<row.size();j++) {
-            QChar rj = row.at(j);
-            QChar rjl = rj.toLower();
-            if(rj == QChar('1') || rj == QChar('2') || rj == QChar('3') || rj == QChar('4')
-                    || rj == QChar('5') || rj == QChar('6') || rj == QChar('7') || rj == QChar('8')) {
-                if(previous_was_digit) {
-                    throw std::invalid_argument("fen: two consecutive digits in rows");
-                } else {
-                    field_sum += rj.digitValue();
-                    previous_was_digit = true;
-                }
-            } else if(rjl == QChar('p') || rjl == QChar('n') || rjl == QChar('b')
-                      || rjl == QChar('r') || rjl == QChar('q') || rjl == QChar('k')) {
-                field_sum += 1;
-                previous_was_digit = false;
-            } else {
+    // check that in each row, there are no two consecutive digits,
+    // and set the pieces. a piece beyond the 8th field of a row is
+    // not set, the row is rejected at its end anyway
+    int row = 0;
+    int square_index = 91;
+    int field_sum = 0;
+    bool previous_was_digit = false;
+    for(int i=part_start[0];i<=part_end[0];i++) {
+        if(i == part_end[0] || fen[i] == '/') {
+            // validate that there are 8 alphanums in each row
+            if(field_sum != 8) {
+                throw std::invalid_argument("fen: field sum is not 8");
+            }
+            row++;
+            square_index = 91 - (row*10);
+            field_sum = 0;
+            previous_was_digit = false;
+            continue;
+        }
+        char rj = fen[i];
+        if(rj >= '1' && rj <= '8') {
+            if(previous_was_digit) {
+                throw std::invalid_argument("fen: two consecutive digits in rows");
+            }
+            field_sum += rj - '0';
+            square_index += rj - '0';
+            previous_was_digit = true;
+        } else {
+            uint8_t piece = this->piece_from_symbol(rj);
+            if(piece == 0x00) {
                 throw std::invalid_argument("fen: two consecutive chars in rows");
             }
-        }
-        // validate that there are 8 alphanums in each row
-        if(field_sum != 8) {
-            throw std::invalid_argument("fen: field sum is not 8");
+            field_sum += 1;
+            if(field_sum <= 8) {
+                this->board[square_index] = piece;
+            }
+            square_index += 1;
+            previous_was_digit = false;
         }
     }
     // check that turn part is valid
-    if(!(fen_parts.at(1) == QString("w") || fen_parts.at(1) == QString("b"))) {
+    const char *turn = fen + part_start[1];
+    int turn_len = part_end[1] - part_start[1];
+    if(turn_len != 1 || (turn[0] != 'w' && turn[0] != 'b')) {
         throw std::invalid_argument("turn part is invalid");
     }
-    // check that castles part in correctly encoded using regex
-    QRegularExpressionMatch match = FEN_CASTLES_REGEX.match(fen_parts[2]);
-    if(!match.hasMatch()) {
-        throw std::invalid_argument("castles encoding is invalid");
-    }
+    // the castles part is not checked, any string matches FEN_CASTLES_REGEX
     // check correct encoding of en passent squares
-    if(fen_parts.at(3) != QChar('-')) {
-        if(fen_parts.at(1) == QChar('w')) {
+    const char *ep = fen + part_start[3];
+    int ep_len = part_end[3] - part_start[3];
+    bool has_ep = !(ep_len == 1 && ep[0] == '-');
+    if(has_ep) {
+        if(turn[0] == 'w') {
             // should be something like "e6" etc. if white is to move
             // check that int value part is sixth rank
-            if(fen_parts.at(3).size() != 2 || fen_parts.at(3).at(1) != QChar('6')) {
+            if(ep_len != 2 || ep[1] != '6') {
                 throw std::invalid_argument("invalid e.p. encoding (white to move)");
             }
         } else {
-            if(fen_parts.at(3).size() != 2 || fen_parts.at(3).at(1) != QChar('3')) {
+            if(ep_len != 2 || ep[1] != '3') {
                 throw std::invalid_argument("invalid e.p. encoding (black to move)");
             }
         }
     }
     // half-move counter validity
-    if(fen_parts.at(4).toInt() < 0) {
+    int halfmoves = this->fen_number(fen + part_start[4], part_end[4] - part_start[4]);
+    if(halfmoves < 0) {
         throw std::invalid_argument("negative half move clock or not a number");
     }
     // full move number validity
-    if(fen_parts.at(5).toInt() < 0) {
+    int fullmoves = this->fen_number(fen + part_start[5], part_end[5] - part_start[5]);
+    if(fullmoves < 0) {
         throw std::invalid_argument("fullmove number not positive");
     }
-    // set pieces
-    for(int i=0;i<rows.size();i++) {
-        int square_index = 91 - (i*10);
-        QString row = rows.at(i);
-        for(int j=0;j<row.size();j++) {
-            QChar rj = row.at(j);
-            QChar rjl = rj.toLower();
-            if(rj == QChar('1') || rj == QChar('2') || rj == QChar('3') || rj == QChar('4')
-                    || rj == QChar('5') || rj == QChar('6') || rj == QChar('7') || rj == QChar('8')) {
-                square_index += rj.digitValue();
-            } else if(rjl == QChar('p') || rjl == QChar('n') || rjl == QChar('b')
-                      || rjl == QChar('r') || rjl == QChar('q') || rjl == QChar('k')) {
-                uint8_t piece = this->piece_from_symbol(rj);
-                this->board[square_index] = piece;
-                square_index += 1;
-            }
-        }
-    }
     // set turn
-    if(fen_parts.at(1) == QString("w")) {
-        this->turn = WHITE;
-    }
-    if(fen_parts.at(1) == QString("b")) {
-        this->turn = BLACK;
-    }
+    this->turn = turn[0] == 'w' ? WHITE : BLACK;
     this->castling_rights = 0x00;
-    for(int i=0;i<fen_parts.at(2).size();i++) {
-        QChar ci = fen_parts.at(2).at(i);
-        if(ci == QChar('K')) {
+    for(int i=part_start[2];i<part_end[2];i++) {
+        char ci = fen[i];
+        if(ci == 'K') {
             this->set_castle_wking(true);
         }
-        if(ci == QChar('Q')) {
+        if(ci == 'Q') {
             this->set_castle_wqueen(true);
         }
-        if(ci == QChar('k')) {
+        if(ci == 'k') {
             this->set_castle_bking(true);
         }
-        if(ci == QChar('q')) {
+        if(ci == 'q') {
             this->set_castle_bqueen(true);
         }
     }
     // set en passent square
-    if(fen_parts.at(3) == QString('-')) {
+    if(!has_ep) {
         this->en_passent_target = 0;
     } else {
-        int row = 10 + (fen_parts.at(3).at(1).digitValue() * 10);
+        int row = 10 + ((ep[1] - '0') * 10);
         int col = 0;
-        QChar c = fen_parts.at(3).at(0).toLower();
-        if(c == 'a') {
-            col = 1;
-        }
-        if(c == 'b') {
-            col = 2;
-        }
-        if(c == 'c') {
-            col = 3;
-        }
-        if(c == 'd') {
-            col = 4;
-        }
-        if(c == 'e') {
-            col = 5;
+        char c = ep[0];
+        if(c >= 'A' && c <= 'H') {
+            c = c - 'A' + 'a';
         }
-        if(c == 'f') {
-            col = 6;
-        }
-        if(c == 'g') {
-            col = 7;
-        }
-        if(c == 'h') {
-            col = 8;
+        if(c >= 'a' && c <= 'h') {
+            col = c - 'a' + 1;
         }
         this->en_passent_target = row + col;
     }
-    this->halfmove_clock = fen_parts.at(4).toInt();
-    this->fullmove_number = fen_parts.at(5).toInt();
+    this->halfmove_clock = halfmoves;
+    this->fullmove_number = fullmoves;
     this->undo_available = false;
+    this->undo_depth = 0;
     this->last_was_null = false;
     if(!this->is_consistent()) {
         throw std::invalid_argument("board position from supplied fen is inconsistent");
     }
-    this->transpositionTable = new QMap<quint64, int>();
+    this->transpositionTable = new QVector<quint64>();
     this->update_transposition_table();
 }
 
@@ -706,64 +762,90 @@ QString Board::idx_to_str(int idx) {
 }
 
 QString Board::fen() {
+    char buf[FEN_MAX_LENGTH];
+    int len = this->fen(buf);
+    return QString::fromLatin1(buf, len);
+}
+
+// writes n in decimal, returns the number of bytes
+static int write_number(char *out, int n) {
+    char digits[12];
+    int len = 0;
+    int count = 0;
+    qint64 value = n;
+    if(value < 0) {
+        out[len++] = '-';
+        value = -value;
+    }
+    do {
+        digits[count++] = char('0' + value % 10);
+        value /= 10;
+    } while(value > 0);
+    while(count > 0) {
+        out[len++] = digits[--count];
+    }
+    return len;
+}
+
+int Board::fen(char *out) {
     // first build board
-    QString fen_string = QString("");
+    int len = 0;
     for(int i=90;i>=20;i-=10) {
         int square_counter = 0;
         for(int j=1;j<9;j++) {
             if(this->board[i+j] != 0x00) {
                 uint8_t piece = this->board[i+j];
-                fen_string.append(this->piece_to_symbol(piece));
+                out[len++] = this->piece_to_symbol(piece).toLatin1();
                 square_counter = 0;
             } else {
                 square_counter += 1;
-                if(j==8) {
-                    fen_string.append(QChar((char) (48+square_counter)));
-                } else {
-                    if(this->board[i+j+1] != 0x00) {
-                        fen_string.append(QChar((char) (48+square_counter)));
-                    }
+                if(j==8 || this->board[i+j+1] != 0x00) {
+                    out[len++] = char(48+square_counter);
                 }
             }
         }
         if(i!=20) {
-            fen_string.append(QChar('/'));
+            out[len++] = '/';
         }
     }
     // write turn
-    if(this->turn == WHITE) {
-        fen_string.append(" w");
-    } else {
-        fen_string.append(" b");
-    }
+    out[len++] = ' ';
+    out[len++] = this->turn == WHITE ? 'w' : 'b';
     // write castling rights
+    out[len++] = ' ';
     if(this->castling_rights == 0x00) {
-        fen_string.append(" -");
+        out[len++] = '-';
     } else {
-        fen_string.append(' ');
         if(this->can_castle_wking()) {
-            fen_string.append(('K'));
+            out[len++] = 'K';
         }
         if(this->can_castle_wqueen()) {
-            fen_string.append(('Q'));
+            out[len++] = 'Q';
         }
         if(this->can_castle_bking()) {
-            fen_string.append(('k'));
+            out[len++] = 'k';
         }
         if(this->can_castle_bqueen()) {
-            fen_string.append(('q'));
+            out[len++] = 'q';
         }
     }
     // write ep target if exists
+    out[len++] = ' ';
     if(this->en_passent_target != 0x00) {
-        fen_string.append(" "+this->idx_to_str(this->en_passent_target));
+        if(this->en_passent_target < 21 || this->en_passent_target > 98) {
+            throw std::invalid_argument("called idx_to_str but idx is in fringe!");
+        }
+        out[len++] = char((this->en_passent_target % 10) + 96);
+        out[len++] = char((this->en_passent_target / 10) + 47);
     } else {
-        fen_string.append(" -");
+        out[len++] = '-';
     }
     // add halfmove clock and fullmove counter
-    fen_string.append(" ").append(QString::number(this->halfmove_clock));
-    fen_string.append(" ").append(QString::number(this->fullmove_number));
-    return fen_string;
+    out[len++] = ' ';
+    len += write_number(out + len, this->halfmove_clock);
+    out[len++] = ' ';
+    len += write_number(out + len, this->fullmove_number);
+    return len;
 }
 
 
@@ -961,9 +1043,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
             if(i!=m.from) {
                 // apply the move, check if king is attacked, and decide
                 bool legal = false;
-                this->apply(m);
+                this->make(m);
                 legal = !this->is_attacked(i,!color);
-                this->undo();
+                this->unmake();
                 return legal;
             } else {
                 // means we move the king
@@ -972,9 +1054,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
                     if(!this->is_attacked(E1,BLACK) && !this->is_attacked(F1,BLACK)
                             && !this->is_attacked(G1,BLACK)) {
                         bool legal = false;
-                        this->apply(m);
+                        this->make(m);
                         legal = !this->is_attacked(G1,BLACK);
-                        this->undo();
+                        this->unmake();
                         return legal;
                     } else {
                         return false;
@@ -984,9 +1066,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
                     if(!this->is_attacked(E8,WHITE) && !this->is_attacked(F8,WHITE)
                             && !this->is_attacked(G8,WHITE)) {
                         bool legal = false;
-                        this->apply(m);
+                        this->make(m);
                         legal = !this->is_attacked(G8,WHITE);
-                        this->undo();
+                        this->unmake();
                         return legal;
                     } else {
                         return false;
@@ -996,9 +1078,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
                     if(!this->is_attacked(E1,BLACK) && !this->is_attacked(D1,BLACK)
                             && !this->is_attacked(C1,BLACK) ) {
                         bool legal = false;
-                        this->apply(m);
+                        this->make(m);
                         legal = !this->is_attacked(C1,BLACK);
-                        this->undo();
+                        this->unmake();
                         return legal;
                     } else {
                         return false;
@@ -1008,9 +1090,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
                     if(!this->is_attacked(E8,WHITE) && !this->is_attacked(D8,WHITE)
                             && !this->is_attacked(C8,WHITE) ) {
                         bool legal = false;
-                        this->apply(m);
+                        this->make(m);
                         legal = !this->is_attacked(C8,WHITE);
-                        this->undo();
+                        this->unmake();
                         return legal;
                     } else {
                         return false;
@@ -1019,9 +1101,9 @@ bool Board::pseudo_is_legal_move(const Move &m) {
                 // if none of the castles cases triggered, we have a standard king move
                 // just check if king isn't attacked after applying the move
                 bool legal = false;
-                this->apply(m);
+                this->make(m);
                 legal = !this->is_attacked(m.to,!color);
-                this->undo();
+                this->unmake();
                 return legal;
             }
         }
@@ -1031,243 +1113,187 @@ bool Board::pseudo_is_legal_move(const Move &m) {
 
 // doesn't account for attacks via en-passent
 bool Board::is_attacked(int idx, bool attacker_color) {
-    // first check for potential pawn attackers
-    // attacker color white, pawn must be white.
-    // lower left
-    if(attacker_color == WHITE && (this->board[idx-9]!=0xFF)
-            && (this->piece_color(idx-9)==WHITE) && (this->piece_type(idx-9)==PAWN)) {
-        return true;
+    if(attacker_color == WHITE) {
+        return this->is_attacked_by<WHITE>(idx);
+    } else {
+        return this->is_attacked_by<BLACK>(idx);
     }
-    // lower right
-    if(attacker_color == WHITE && (this->board[idx-11]!=0xFF)
-            && (this->piece_color(idx-11)==WHITE) && (this->piece_type(idx-11)==PAWN)) {
+}
+
+template<bool attacker_color>
+bool Board::is_attacked_by(int idx) {
+    const uint8_t color_bit = attacker_color == WHITE ? 0x00 : 0x80;
+    // first check for potential pawn attackers. white pawns
+    // attack from lower left and right, black ones from above
+    const int pawn_left = attacker_color == WHITE ? -9 : 9;
+    const int pawn_right = attacker_color == WHITE ? -11 : 11;
+    if(this->board[idx + pawn_left] == (PAWN | color_bit)
+            || this->board[idx + pawn_right] == (PAWN | color_bit)) {
         return true;
     }
-    // check black, upper right
-    if(attacker_color == BLACK && (this->board[idx+11]!=0xFF)
-            && (this->piece_color(idx+11)==BLACK) && (this->piece_type(idx+11)==PAWN)) {
-        return true;
+    // pieces (other than pawns) can't attack a square
+    // occupied by their own side
+    if(this->board[idx] != 0x00 && (this->board[idx] & 0x80) == color_bit) {
+        return false;
     }
-    // check black, upper left
-    if(attacker_color == BLACK && (this->board[idx+9]!=0xFF)
-            && (this->piece_color(idx+9)==BLACK) && (this->piece_type(idx+9)==PAWN)) {
-        return true;
+    // knights and king one step away
+    for(const uint8_t *from = KNIGHT_TARGETS[idx].v;*from != 0;from++) {
+        if(this->board[*from] == (KNIGHT | color_bit)) {
+            return true;
+        }
     }
-    // check all squares (except idx itself)
-    // for potential attackers
-    for(int i=21;i<99;i++) {
-        // skip empty squares
-        if(i!=idx && this->board[i] != 0x00) {
-            // can't attack yourself
-            if(this->piece_color(i) == attacker_color) {
-                uint8_t piece = this->piece_type(i);
-                int distance = idx - i;
-                if(distance < 0) {
-                    distance = -distance;
-                }
-                IntBits pot_attackers = IntBits(ATTACK_TABLE[distance]);
-                if((piece == KNIGHT && pot_attackers.test(0)) ||
-                        (piece == BISHOP && pot_attackers.test(1)) ||
-                        (piece == ROOK && pot_attackers.test(2)) ||
-                        (piece == QUEEN && pot_attackers.test(3)) ||
-                        (piece == KING && pot_attackers.test(4))) {
-                    // the target could be a potential attacker
-                    // now just get all pseudo legal moves from i,
-                    // excluding castling. If a move contains
-                    // target idx, then we have an attacker
-                    Moves* targets = this->pseudo_legal_moves_from(i,false,attacker_color);
-                    for(int j=0;j<targets->size();j++) {
-                        if(targets->at(j).to == idx) {
-                            targets->clear();
-                            delete(targets);
-                            return true;
-                        }
-                    }
-                    targets->clear();
-                    delete(targets);
-                }
+    for(const uint8_t *from = KING_TARGETS[idx].v;*from != 0;from++) {
+        if(this->board[*from] == (KING | color_bit)) {
+            return true;
+        }
+    }
+    // follow each ray from idx to the first piece on it. the first
+    // four rays are diagonal, the other four straight
+    for(int j=0;j<8;j++) {
+        const uint8_t *from = RAYS[idx][j].v;
+        while(*from != 0 && this->board[*from] == 0x00) {
+            from++;
+        }
+        if(*from != 0) {
+            uint8_t piece = this->board[*from];
+            if(piece == (QUEEN | color_bit) || (j < 4 && piece == (BISHOP | color_bit))
+                    || (j >= 4 && piece == (ROOK | color_bit))) {
+                return true;
             }
         }
     }
     return false;
 }
 
+// appends a pawn move, or all four promotions
+static inline void append_pawn_move(Moves *moves, int from, int to, bool promotes) {
+    if(promotes) {
+        moves->append(Move(from,to,QUEEN));
+        moves->append(Move(from,to,ROOK));
+        moves->append(Move(from,to,BISHOP));
+        moves->append(Move(from,to,KNIGHT));
+    } else {
+        moves->append(Move(from,to));
+    }
+}
+
 // calling with from_square = 0 means all possible moves
 // will find all pseudo legal move for supplied player (turn must be
 // either WHITE or BLACK)
 Moves* Board::pseudo_legal_moves_from(int from_square, bool with_castles, bool turn) {
-
     Moves* moves = new Moves();
+    if(turn == WHITE) {
+        this->pseudo_legal_moves_of<WHITE>(from_square, with_castles, moves);
+    } else {
+        this->pseudo_legal_moves_of<BLACK>(from_square, with_castles, moves);
+    }
+    return moves;
+}
 
-    for(int i=21;i<99;i++) {
-        if(from_square == 0 || from_square == i) {
-            // skip offboard's left and right
-            if(!(this->board[i] == 0xFF)) {
-                // get piece type & color
-                bool color = this->piece_color(i);
-                if(color == turn) {
-                    uint8_t piece = this->piece_type(i);
-                    // handle case of PAWN
-                    if(piece == PAWN) {
-                        uint8_t piece_idx = IDX_WPAWN;
-                        if(color == BLACK) {
-                            piece_idx = IDX_BPAWN;
-                        }
-                        // take up right, or up left
-                        for(int j=3;j<=4;j++) {
-                            uint8_t idx = i + DIR_TABLE[piece_idx][j];
-                            if(!this->is_offside(idx)) {
-                                if((!this->is_empty(idx) && color==BLACK && this->is_white_at(idx)) ||
-                                        (!this->is_empty(idx) && color==WHITE && !this->is_white_at(idx))) {
-                                    // if it's a promotion square, add four moves
-                                    if((color==WHITE && (idx / 10 == 9)) || (color==BLACK && (idx / 10 == 2))) {
-                                        moves->append(Move(i,idx,QUEEN));
-                                        moves->append(Move(i,idx,ROOK));
-                                        moves->append(Move(i,idx,BISHOP));
-                                        moves->append(Move(i,idx,KNIGHT));
-                                    } else {
-                                        moves->append(Move(i,idx));
-                                    }
-                                }
-                            }
-                        }
-                        // move one (j=1) or two (j=2) up (or down in the case of black)
-                        for(int j=1;j<=2;j++) {
-                            uint8_t idx = i + DIR_TABLE[piece_idx][j];
-                            if(!this->is_offside(idx)) {
-                                if(j==2 && ((color == WHITE && (i/10==3)) || (color==BLACK && (i/10==8)))) {
-                                    // means we have a white/black pawn in inital position, direct square
-                                    // in front is empty => allow to move two forward
-                                    if(this->is_empty(idx)) {
-                                        moves->append(Move(i,idx));
-                                    }
-                                }
-                                else if(j==1) {
-                                    // case of one-step move forward
-                                    if(!this->is_empty(idx)) {
-                                        break;
-                                    } else {
-                                        // if it's a promotion square, add four moves
-                                        if((color==WHITE && (idx / 10 == 9)) || (color==BLACK && (idx / 10 == 2))) {
-                                            moves->append(Move(i,idx,QUEEN));
-                                            moves->append(Move(i,idx,ROOK));
-                                            moves->append(Move(i,idx,BISHOP));
-                                            moves->append(Move(i,idx,KNIGHT));
-                                        } else {
-                                            moves->append(Move(i,idx));
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        // finally, potential en-passent capture is handled
-                        // left up
-                        if(color == WHITE && (this->en_passent_target - i)==9) {
-                            Move m = (Move(i,this->en_passent_target));
-                            moves->append(m);
-                        }
-                        // right up
-                        if(color == WHITE && (this->en_passent_target - i)==11) {
-                            Move m = (Move(i,this->en_passent_target));
-                            moves->append(m);
-                        }
-                        // left down
-                        if(color == BLACK && (this->en_passent_target - i)==-9) {
-                            Move m = (Move(i,this->en_passent_target));
-                            moves->append(m);
-                        }
-                        if(color == BLACK && (this->en_passent_target - i)==-11) {
-                            Move m = (Move(i,this->en_passent_target));
-                            moves->append(m);
-                        }
-                    }
-                    // handle case of knight
-                    if(piece == KNIGHT || piece == KING) {
-                        int lookup_idx;
-                        if(piece == KNIGHT) {
-                            lookup_idx = IDX_KNIGHT;
-                        } else {
-                            lookup_idx = IDX_KING;
-                        }
-                        for(int j=1;j<=DIR_TABLE[lookup_idx][0];j++) {
-                            uint8_t idx = i + DIR_TABLE[lookup_idx][j];
-                            if(!this->is_offside(idx)) {
-                                if(this->is_empty(idx) ||
-                                        (this->piece_color(idx) != color)) {
-                                    moves->append(Move(i,idx));
-                                }
-                            }
-                        }
-                    }
-                    // handle case of bishop, rook, queen
-                    if(piece == ROOK || piece == BISHOP || piece == QUEEN) {
-                        int lookup_idx = IDX_ROOK;
-                        if(piece == QUEEN) {
-                            lookup_idx = IDX_QUEEN;
-                        }
-                        if(piece == BISHOP) {
-                            lookup_idx = IDX_BISHOP;
-                        }
-                        for(int j=1;j<=DIR_TABLE[lookup_idx][0] ;j++) {
-                            uint8_t idx = i + DIR_TABLE[lookup_idx][j];
-                            bool stop = false;
-                            while(!stop) {
-                                if(!this->is_offside(idx)) {
-                                    if(this->is_empty(idx)) {
-                                        moves->append(Move(i,idx));
-                                    } else {
-                                        stop = true;
-                                        if(this->piece_color(idx) != color) {
-                                            moves->append(Move(i,idx));
-                                        }
-                                    }
-                                    idx = idx + DIR_TABLE[lookup_idx][j];
-                                } else {
-                                    stop = true;
-                                }
-                            }
-                        }
-                    }
+template<bool color>
+void Board::pseudo_legal_moves_of(int from_square, bool with_castles, Moves *moves) {
+    // white pawns go up the board, start on the second rank and
+    // promote on the eighth, black ones the other way round
+    const uint8_t color_bit = color == WHITE ? 0x00 : 0x80;
+    const int up = color == WHITE ? 10 : -10;
+    const int up_left = color == WHITE ? 9 : -9;
+    const int up_right = color == WHITE ? 11 : -11;
+    const uint8_t start_rank = color == WHITE ? 1 : 6;
+    const uint8_t last_rank = color == WHITE ? 7 : 0;
+
+    // with a from square, only that one is visited
+    int first = from_square == 0 ? 21 : std::max(from_square, 21);
+    int last = from_square == 0 ? 98 : std::min(from_square, 98);
+    for(int i=first;i<=last;i++) {
+        uint8_t square = this->board[i];
+        // skip empty squares, the fringe and pieces of the other side
+        if(square == 0x00 || square == 0xFF || (square & 0x80) != color_bit) {
+            continue;
+        }
+        uint8_t piece = square & 0x7F;
+        if(piece == PAWN) {
+            // take up right, or up left
+            int captures[2] = { i + up_right, i + up_left };
+            for(int j=0;j<2;j++) {
+                uint8_t target = this->board[captures[j]];
+                if(target != 0x00 && target != 0xFF && (target & 0x80) != color_bit) {
+                    append_pawn_move(moves, i, captures[j], SQUARE_RANK[captures[j]] == last_rank);
                 }
             }
-            if(with_castles) {
-                if(this->turn == WHITE) {
-                    // check for castling
-                    // white kingside
-                    if(i==E1 && !this->is_empty(E1) && this->can_castle_wking() &&
-                            this->piece_color(E1) == WHITE && this->piece_color(H1) == WHITE
-                            && this->piece_type(E1) == KING && this->piece_type(H1) == ROOK
-                            && this->is_empty(F1) && this->is_empty(G1)) {
-                        moves->append(Move(E1,G1));
-                    }
-                    // white queenside
-                    if(i==E1 && !this->is_empty(E1) && this->can_castle_wqueen() &&
-                            this->piece_color(E1) == WHITE && this->piece_color(A1) == WHITE
-                            && this->piece_type(E1) == KING && this->piece_type(A1) == ROOK
-                            && this->is_empty(D1) && this->is_empty(C1) && this->is_empty(B1)) {
-                        moves->append(Move(E1,C1));
-                    }
+            // move one or, from the initial position, two up (or down
+            // in the case of black) if the squares in front are empty
+            if(this->board[i + up] == 0x00) {
+                append_pawn_move(moves, i, i + up, SQUARE_RANK[i + up] == last_rank);
+                if(SQUARE_RANK[i] == start_rank && this->board[i + 2 * up] == 0x00) {
+                    moves->append(Move(i,i + 2 * up));
                 }
-                if(this->turn == BLACK) {
-                    // black kingside
-                    if(i==E8 && !this->is_empty(E8) && this->can_castle_bking() &&
-                            this->piece_color(E8) == BLACK && this->piece_color(H8) == BLACK
-                            && this->piece_type(E8) == KING && this->piece_type(H8) == ROOK
-                            && this->is_empty(F8) && this->is_empty(G8)) {
-                        moves->append(Move(E8,G8));
-                    }
-                    // black queenside
-                    if(i==E8 && !this->is_empty(E8) && this->can_castle_bqueen() &&
-                            this->piece_color(E8) == BLACK && this->piece_color(A8) == BLACK
-                            && this->piece_type(E8) == KING && this->piece_type(A8) == ROOK
-                            && this->is_empty(D8) && this->is_empty(C8) && this->is_empty(B8)) {
-                        moves->append(Move(E8,C8));
+            }
+            // finally, potential en-passent capture is handled
+            if(this->en_passent_target == i + up_left) {
+                moves->append(Move(i,this->en_passent_target));
+            }
+            if(this->en_passent_target == i + up_right) {
+                moves->append(Move(i,this->en_passent_target));
+            }
+        } else if(piece == KNIGHT || piece == KING) {
+            const uint8_t *to = piece == KNIGHT ? KNIGHT_TARGETS[i].v : KING_TARGETS[i].v;
+            for(;*to != 0;to++) {
+                if(this->board[*to] == 0x00 || (this->board[*to] & 0x80) != color_bit) {
+                    moves->append(Move(i,*to));
+                }
+            }
+            if(piece == KING && with_castles) {
+                this->castling_moves_of<color>(i, moves);
+            }
+        } else {
+            // bishop, rook, queen. the rays of a bishop are
+            // the first four of the queen, of a rook the last four
+            int first_ray = piece == ROOK ? 4 : 0;
+            int last_ray = piece == BISHOP ? 4 : 8;
+            for(int j=first_ray;j<last_ray;j++) {
+                for(const uint8_t *to = RAYS[i][j].v;*to != 0;to++) {
+                    if(this->board[*to] == 0x00) {
+                        moves->append(Move(i,*to));
+                    } else {
+                        if((this->board[*to] & 0x80) != color_bit) {
+                            moves->append(Move(i,*to));
+                        }
+                        break;
                     }
                 }
             }
         }
     }
-    return moves;
+}
+
+template<bool color>
+void Board::castling_moves_of(int king, Moves *moves) {
+    // castling rights are cleared when king or rook move, but
+    // positions from a fen may still claim them wrongly
+    if(color == WHITE && king == E1) {
+        // white kingside
+        if(this->can_castle_wking() && this->board[H1] == ROOK
+                && this->is_empty(F1) && this->is_empty(G1)) {
+            moves->append(Move(E1,G1));
+        }
+        // white queenside
+        if(this->can_castle_wqueen() && this->board[A1] == ROOK
+                && this->is_empty(D1) && this->is_empty(C1) && this->is_empty(B1)) {
+            moves->append(Move(E1,C1));
+        }
+    }
+    if(color == BLACK && king == E8) {
+        // black kingside
+        if(this->can_castle_bking() && this->board[H8] == (ROOK | 0x80)
+                && this->is_empty(F8) && this->is_empty(G8)) {
+            moves->append(Move(E8,G8));
+        }
+        // black queenside
+        if(this->can_castle_bqueen() && this->board[A8] == (ROOK | 0x80)
+                && this->is_empty(D8) && this->is_empty(C8) && this->is_empty(B8)) {
+            moves->append(Move(E8,C8));
+        }
+    }
 }
 
 bool Board::movePromotes(const Move&m) {
@@ -1284,18 +1310,11 @@ bool Board::movePromotes(const Move&m) {
 
 
 bool Board::piece_color(uint8_t idx) {
-    IntBits piece = IntBits(this->board[idx]);
-    if(piece.test(COLOR_FLAG) == WHITE) {
-        return WHITE;
-    } else {
-        return BLACK;
-    }
+    return (this->board[idx] >> COLOR_FLAG) & 1 ? BLACK : WHITE;
 }
 
 uint8_t Board::piece_type(uint8_t idx) {
-    IntBits piece = IntBits(this->board[idx]);
-    piece.set(7,0);
-    return static_cast<uint8_t>(piece.to_ulong());
+    return this->board[idx] & 0x7F;
 }
 
 uint8_t Board::piece_at(uint8_t idx) {
@@ -1334,57 +1353,90 @@ bool Board::can_claim_fifty_moves() {
 
 // returns true (== Black) if not occupied!
 bool Board::is_white_at(uint8_t idx) {
-    IntBits square = IntBits(this->board[idx]);
-    if(square.test(COLOR_FLAG)) {
-        return false;
-    } else {
-        return true;
-    }
+    return !((this->board[idx] >> COLOR_FLAG) & 1);
 }
 
 
 // doesn't check legality
 void Board::apply(const Move &m) {
+    this->do_move(m, &this->last_undo);
+    // after move is applied, can revert to the previous position
+    this->undo_available = true;
+}
+
+void Board::make(const Move &m) {
+    if(this->undo_depth == this->undo_stack.size()) {
+        this->undo_stack.resize(this->undo_depth + 64);
+    }
+    this->do_move(m, this->undo_stack.data() + this->undo_depth);
+    this->undo_depth++;
+}
+
+Move Board::unmake() {
+    if(this->undo_depth == 0) {
+        throw std::logic_error("must call board.make(move) each time before calling unmake()");
+    }
+    this->undo_depth--;
+    const UndoRecord &undo = this->undo_stack.at(this->undo_depth);
+    this->undo_move(undo);
+    return undo.move;
+}
+
+int Board::make_depth() {
+    return this->undo_depth;
+}
+
+void Board::do_move(const Move &m, UndoRecord *undo) {
     assert(m.promotion_piece <= 5);
+    undo->move = m;
+    undo->captured = EMPTY;
+    undo->captured_at = 0;
+    undo->castling_rights = this->castling_rights;
+    undo->en_passent_target = this->en_passent_target;
+    undo->halfmove_clock = this->halfmove_clock;
+    undo->last_was_null = this->last_was_null;
     if(m.is_null) {
-        //std::cout << "applying null move: " << m.uci_string.toStdString() << std::endl;
+        //std::cout << "applying null move: " << m << std::endl;
         //std::cout << (*this) << std::endl;
         this->turn = !this->turn;
-        this->prev_en_passent_target = this->en_passent_target;
         this->en_passent_target = 0;
         this->last_was_null = true;
-        this->undo_available = true;
     } else {
         this->last_was_null = false;
+        // the colour of the moving piece decides which
+        // pawn directions and castling squares apply
+        if(this->piece_color(m.from) == WHITE) {
+            this->apply_move<WHITE>(m, undo);
+        } else {
+            this->apply_move<BLACK>(m, undo);
+        }
+    }
+}
+
+template<bool color>
+void Board::apply_move(const Move &m, UndoRecord *undo) {
     this->turn = !this->turn;
-    this->prev_en_passent_target = this->en_passent_target;
-    this->prev_castling_rights = this->castling_rights;
     this->en_passent_target = 0;
     if(this->turn == WHITE) {
         this->fullmove_number++;
     }
-    for(int i=0;i<120;i++) {
-        this->old_board[i] = this->board[i];
-    }
     uint8_t old_piece_type = this->piece_type(m.from);
-    bool color = this->piece_color(m.from);
+    if(this->board[m.to] != EMPTY) {
+        undo->captured = this->board[m.to];
+        undo->captured_at = m.to;
+    }
     // increase halfmove clock only if no capture or pawn advance
     // happended
-    this->prev_halfmove_clock = this->halfmove_clock;
     if(old_piece_type == PAWN || this->board[m.to] != EMPTY) {
         this->halfmove_clock = 0;
     } else {
         this->halfmove_clock++;
     }
-    // if we move a pawn two steps up, set the en_passent field
+    // if we move a pawn two steps up (or down for black), set the en_passent field
+    const int up = color == WHITE ? 10 : -10;
     if(old_piece_type == PAWN) {
-        // white pawn moved two steps up
-        if((m.to - m.from) == 20) {
-            this->en_passent_target = m.from + 10;
-        }
-        // black pawn moved two steps up (down)
-        if((m.to - m.from == -20)) {
-            this->en_passent_target = m.from - 10;
+        if((m.to - m.from) == 2 * up) {
+            this->en_passent_target = m.from + up;
         }
     }
     // if the move is an en-passent capture,
@@ -1396,15 +1448,11 @@ void Board::apply(const Move &m) {
     // is down right or down left and empty
     // also set last_move_was_ep to true
     if(old_piece_type == PAWN) {
-        if(this->board[m.to] == EMPTY) {
-            if(color == WHITE && ((m.to-m.from == 9) || (m.to-m.from)==11)) {
-                // remove captured pawn
-                this->board[m.to-10] = 0x00;
-            }
-            if(color == BLACK && ((m.from -m.to == 9) || (m.from - m.to)==11)) {
-                // remove captured pawn
-                this->board[m.to+10] = 0x00;
-            }
+        if(this->board[m.to] == EMPTY && ((m.to - m.from) == up - 1 || (m.to - m.from) == up + 1)) {
+            // remove captured pawn
+            undo->captured = this->board[m.to - up];
+            undo->captured_at = m.to - up;
+            this->board[m.to - up] = 0x00;
         }
     }
     // if the move is a promotion, the target
@@ -1513,43 +1561,111 @@ void Board::apply(const Move &m) {
             this->set_castle_wqueen(false);
         }
     }
-    // after move is applied, can revert to the previous position
-    this->undo_available = true;
-    }
 }
 
 void Board::undo() {
-    if(!this->undo_available) {
+    // moves made after the applied one must be unmade first
+    if(!this->undo_available || this->undo_depth > 0) {
         throw std::logic_error("must call board.apply(move) each time before calling undo() ");
+    }
+    this->undo_move(this->last_undo);
+    this->undo_available = false;
+}
+
+bool Board::is_undo_available() {
+    return this->undo_available && this->undo_depth == 0;
+}
 
+void Board::undo_move(const UndoRecord &undo) {
+    if(undo.move.is_null) {
+        this->turn = !this->turn;
+    } else if(this->piece_color(undo.move.to) == WHITE) {
+        this->unmake_move<WHITE>(undo);
     } else {
-        if(this->last_was_null) {
-            this->turn = !this->turn;
-            this->en_passent_target = this->prev_en_passent_target;
-            this->prev_en_passent_target = 0;
-            this->last_was_null = false;
-            this->undo_available = true;
-        } else {
-            for(int i=0;i<120;i++) {
-                this->board[i] = this->old_board[i];
-            }
-            this->undo_available = false;
-            this->en_passent_target = this->prev_en_passent_target;
-            this->prev_en_passent_target = 0;
-            this->castling_rights = this->prev_castling_rights;
-            this->turn = !this->turn;
-            this->halfmove_clock = this->prev_halfmove_clock;
-            this->prev_halfmove_clock = 0;
-            if(this->turn == BLACK) {
-                this->fullmove_number--;
-            }
+        this->unmake_move<BLACK>(undo);
+    }
+    this->castling_rights = undo.castling_rights;
+    this->en_passent_target = undo.en_passent_target;
+    this->halfmove_clock = undo.halfmove_clock;
+    this->last_was_null = undo.last_was_null;
+}
+
+template<bool color>
+void Board::unmake_move(const UndoRecord &undo) {
+    const Move &m = undo.move;
+    this->turn = !this->turn;
+    if(this->turn == BLACK) {
+        this->fullmove_number--;
+    }
+    // a promoted piece goes back as pawn
+    if(m.promotion_piece != EMPTY) {
+        this->board[m.from] = color == WHITE ? WHITE_PAWN : BLACK_PAWN;
+    } else {
+        this->board[m.from] = this->board[m.to];
+    }
+    this->board[m.to] = EMPTY;
+    if(undo.captured_at != 0) {
+        this->board[undo.captured_at] = undo.captured;
+    }
+    // put back the rook of castles
+    if(this->board[m.from] == (color == WHITE ? WHITE_KING : BLACK_KING)) {
+        const uint8_t home = color == WHITE ? E1 : E8;
+        if(m.from == home && m.to == home + 2) {
+            this->board[home + 3] = this->board[home + 1];
+            this->board[home + 1] = EMPTY;
+        }
+        if(m.from == home && m.to == home - 2) {
+            this->board[home - 4] = this->board[home - 1];
+            this->board[home - 1] = EMPTY;
         }
     }
 }
 
 // doesn't check legality
+void Board::apply_and_record(const Move &m) {
+    this->apply(m);
+    this->update_transposition_table();
+}
+
+void Board::save_state(BoardState *state) {
+    for(int i=0;i<120;i++) {
+        state->board[i] = this->board[i];
+    }
+    state->turn = this->turn;
+    state->castling_rights = this->castling_rights;
+    state->en_passent_target = this->en_passent_target;
+    state->halfmove_clock = this->halfmove_clock;
+    state->fullmove_number = this->fullmove_number;
+    state->last_was_null = this->last_was_null;
+}
+
+void Board::restore_state(const BoardState &state) {
+    for(int i=0;i<120;i++) {
+        this->board[i] = state.board[i];
+    }
+    this->turn = state.turn;
+    this->castling_rights = state.castling_rights;
+    this->en_passent_target = state.en_passent_target;
+    this->halfmove_clock = state.halfmove_clock;
+    this->fullmove_number = state.fullmove_number;
+    this->last_was_null = state.last_was_null;
+    this->undo_available = false;
+    this->undo_depth = 0;
+}
+
 Board* Board::copy_and_apply(const Move &m) {
     Board *b = new Board();
+    this->copy_and_apply_into(b, m);
+    return b;
+}
+
+Board* Board::copy_and_apply(const Move &m, Arena *arena) {
+    Board *b = arena->make<Board>();
+    this->copy_and_apply_into(b, m);
+    return b;
+}
+
+void Board::copy_and_apply_into(Board *b, const Move &m) {
     b->turn = this->turn;
     b->castling_rights = this->castling_rights;
     b->turn = this->turn;
@@ -1558,16 +1674,12 @@ Board* Board::copy_and_apply(const Move &m) {
     b->fullmove_number = this->fullmove_number;
     b->undo_available = this->undo_available;
     b->last_was_null = this->last_was_null;
-    b->prev_halfmove_clock = this->prev_halfmove_clock;
-    delete b->transpositionTable;
-    b->transpositionTable = new QMap<quint64, int>(*this->transpositionTable);
+    *b->transpositionTable = *this->transpositionTable;
     for(int i=0;i<120;i++) {
         b->board[i] = this->board[i];
-        b->old_board[i] = this->old_board[i];
     }
     b->apply(m);
     b->update_transposition_table();
-    return b;
 }
 
 bool Board::is_stalemate() {
@@ -1594,13 +1706,7 @@ bool Board::is_stalemate() {
 }
 
 bool Board::is_threefold_repetition() {
-    quint64 current_zobrist = this->zobrist();
-    if(this->transpositionTable->contains(current_zobrist)) {
-        int cnt = this->transpositionTable->value(current_zobrist);
-        return cnt >= 3;
-    } else {
-        return false;
-    }
+    return this->transpositionTable->count(this->zobrist()) >= 3;
 }
 
 bool Board::is_checkmate() {
@@ -1627,13 +1733,10 @@ bool Board::is_checkmate() {
 }
 
 bool Board::is_check() {
+    uint8_t king = this->turn == BLACK ? KING + 128 : KING;
     for(int i=21;i<99;i++) {
-        if((this->piece_type(i)==KING) && (this->piece_color(i)==this->turn)){
-            if(this->is_attacked(i,!this->turn)) {
-                return true;
-            } else {
-                return false;
-            }
+        if(this->board[i] == king) {
+            return this->is_attacked(i,!this->turn);
         }
     }
     return false;
@@ -1666,135 +1769,136 @@ uint8_t Board::alpha_to_pos(QChar alpha) {
 // current board
 QString Board::san(const Move &m) {
 
-    QString san = QString("");
     // first check for null move
     if(m.is_null) {
-        san = QString("--");
-        return san;
+        return QString("--");
     }
 
-    // first test for checkmate and check (to be appended later)
-    // create temp board, since appyling move and
-    // testing for checkmate (which again needs
-    // application of a move) makes it impossible
-    // to undo (undo can only be done once, not twice in a row)
-    Board *b_temp = this->copy_and_apply(m);
-    bool is_check = b_temp->is_check();
-    bool is_checkmate = b_temp->is_checkmate();
+    char buf[SAN_MAX_LENGTH];
+    int len = this->san_body(m, buf);
+
+    // make the move on this board and test for check on the king
+    // square. only a check can be mate, so the legal moves of the
+    // new position are generated only then
+    this->make(m);
+    if(this->is_check()) {
+        buf[len++] = this->is_checkmate() ? '#' : '+';
+    }
+    this->unmake();
+    return QString::fromLatin1(buf, len);
+}
 
+int Board::san_body(const Move &m, char *out) {
+
+    if(m.is_null) {
+        out[0] = '-';
+        out[1] = '-';
+        return 2;
+    }
+    int len = 0;
     if(this->castles_wking(m) || this->castles_bking(m)) {
-        san.append("O-O");
-        if(is_checkmate) {
-            san.append("#");
-        }
-        if(is_check) {
-            san.append("+");
-        }
-        return san;
+        memcpy(out, "O-O", 3);
+        return 3;
     } else if(this->castles_wqueen(m) || this->castles_bqueen(m)) {
-        san.append("O-O-O");
-        if(is_checkmate) {
-            san.append("#");
-        } else if(is_check) {
-            san.append("+");
-        }
-        return san;
-    } else {
-        uint8_t piece_type = this->piece_type(m.from);
-        Moves* legals = this->legal_moves();
-        if(piece_type == KNIGHT) {
-            san.append("N");
-        }
+        memcpy(out, "O-O-O", 5);
+        return 5;
+    }
+    uint8_t piece_type = this->piece_type(m.from);
+    if(piece_type == KNIGHT) {
+        out[len++] = 'N';
+    }
+    if(piece_type == BISHOP) {
+        out[len++] = 'B';
+    }
+    if(piece_type == ROOK) {
+        out[len++] = 'R';
+    }
+    if(piece_type == QUEEN) {
+        out[len++] = 'Q';
+    }
+    if(piece_type == KING) {
+        out[len++] = 'K';
+    }
+    int this_row = (m.from / 10) - 1;
+    int this_col = m.from % 10;
+
+    // find amibguous moves (except for pawns). there is only one king,
+    // other pieces of the same kind that could also go to the target
+    // are found by looking from the target in their directions
+    if(piece_type != PAWN && piece_type != KING) {
+        uint8_t piece = this->board[m.from];
+        int lookup_idx = IDX_KNIGHT;
         if(piece_type == BISHOP) {
-            san.append("B");
-        }
-        if(piece_type == ROOK) {
-            san.append("R");
-        }
-        if(piece_type == QUEEN) {
-            san.append("Q");
-        }
-        if(piece_type == KING) {
-            san.append("K");
-        }
-        Moves* col_disambig = new Moves();
-        Moves* row_disambig = new Moves();
-        int this_row = (m.from / 10) - 1;
-        int this_col = m.from % 10;
-
-        // find amibguous moves (except for pawns)
-        if(piece_type != PAWN) {
-            for(int i=0;i<legals->count();i++) {
-                Move mi = legals->at(i);
-                if(this->piece_type(mi.from) == piece_type && mi.to == m.to && mi.from != m.from) {
-                    // found pontential amibg. move
-                    if((mi.from % 10) != this_col) {
-                        // can be resolved via row
-                        col_disambig->append(mi);
-                    } else { // otherwise resolve by col
-                        row_disambig->append(mi);
-                    }
+            lookup_idx = IDX_BISHOP;
+        } else if(piece_type == ROOK) {
+            lookup_idx = IDX_ROOK;
+        } else if(piece_type == QUEEN) {
+            lookup_idx = IDX_QUEEN;
+        }
+        int cnt_col_disambig = 0;
+        int cnt_row_disambig = 0;
+        for(int j=1;j<=DIR_TABLE[lookup_idx][0];j++) {
+            int8_t dir = DIR_TABLE[lookup_idx][j];
+            int i = m.to + dir;
+            if(piece_type != KNIGHT) {
+                while(this->board[i] == 0x00) {
+                    i += dir;
                 }
             }
-            int cnt_col_disambig = col_disambig->count();
-            //cout << "ambig cols: " << +cnt_col_disambig << endl;
-            int cnt_row_disambig = row_disambig->count();
-            //cout << "ambig rows: " << +cnt_row_disambig << endl;
-            row_disambig->clear();
-            col_disambig->clear();
-            delete row_disambig;
-            delete col_disambig;
-            // if there is an ambiguity
-            if(cnt_col_disambig != 0 || cnt_row_disambig != 0) {
-                // preferred way: resolve via column
-                if(cnt_col_disambig>0 && cnt_row_disambig==0) {
-                    san.append(QChar(this_col + 96));
-                    // if not try to resolve via row
-                } else if(cnt_row_disambig>0 && cnt_col_disambig==0) {
-                    san.append(QChar(this_row + 48));
-                } else {
-                    // if that also fails (think three queens)
-                    // resolve via full coordinate
-                    san.append(QChar(this_col + 96));
-                    san.append(QChar(this_row + 48));
+            // a pinned piece can't go there and doesn't count
+            if(i != m.from && this->board[i] == piece && this->pseudo_is_legal_move(Move(i, m.to))) {
+                // found pontential amibg. move
+                if((i % 10) != this_col) {
+                    // can be resolved via row
+                    cnt_col_disambig++;
+                } else { // otherwise resolve by col
+                    cnt_row_disambig++;
                 }
             }
-        } else {
-            delete col_disambig;
-            delete row_disambig;
-        }
-        // handle a capture, i.e. if destination field
-        // is not empty
-        if(this->piece_type(m.to) != EMPTY) {
-            if(piece_type == PAWN) {
-                san.append(QChar(this_col + 96));
-            }
-            san.append(QString("x"));
         }
-        //qDebug() << "calling idx to str: ";
-        //qDebug() << "san append: " << m.to;
-        //qDebug() << m.uci_string;
-        //qDebug() << "--";
-        san.append(this->idx_to_str(m.to));
-        if(m.promotion_piece == KNIGHT) {
-            san.append(("=N"));
-        }
-        if(m.promotion_piece == BISHOP) {
-            san.append(("=B"));
-        }
-        if(m.promotion_piece == ROOK) {
-            san.append(("=R"));
+        // if there is an ambiguity
+        if(cnt_col_disambig != 0 || cnt_row_disambig != 0) {
+            // preferred way: resolve via column
+            if(cnt_col_disambig>0 && cnt_row_disambig==0) {
+                out[len++] = char(this_col + 96);
+                // if not try to resolve via row
+            } else if(cnt_row_disambig>0 && cnt_col_disambig==0) {
+                out[len++] = char(this_row + 48);
+            } else {
+                // if that also fails (think three queens)
+                // resolve via full coordinate
+                out[len++] = char(this_col + 96);
+                out[len++] = char(this_row + 48);
+            }
         }
-        if(m.promotion_piece == QUEEN) {
-            san.append(("=Q"));
+    }
+    // handle a capture, i.e. if destination field
+    // is not empty, or a pawn moves sideways (en passent)
+    if(this->piece_type(m.to) != EMPTY || (piece_type == PAWN && (m.to % 10) != this_col)) {
+        if(piece_type == PAWN) {
+            out[len++] = char(this_col + 96);
         }
+        out[len++] = 'x';
+    }
+    out[len++] = char((m.to % 10) + 96);
+    out[len++] = char((m.to / 10) + 47);
+    if(m.promotion_piece == KNIGHT) {
+        out[len++] = '=';
+        out[len++] = 'N';
+    }
+    if(m.promotion_piece == BISHOP) {
+        out[len++] = '=';
+        out[len++] = 'B';
     }
-    if(is_checkmate) {
-        san.append("#");
-    } else if(is_check) {
-        san.append("+");
+    if(m.promotion_piece == ROOK) {
+        out[len++] = '=';
+        out[len++] = 'R';
     }
-    return san;
+    if(m.promotion_piece == QUEEN) {
+        out[len++] = '=';
+        out[len++] = 'Q';
+    }
+    return len;
 }
 
 Move Board::parse_san(QString san) {
@@ -1935,7 +2039,6 @@ Move Board::parse_san(QString san) {
             m.from = mi.from;
             m.to = mi.to;
             m.promotion_piece = mi.promotion_piece;
-            m.uci_string = mi.uci_string;
         }
     }
     delete legals;
@@ -2244,13 +2347,7 @@ int Board::zobrist_piece_type(uint8_t piece) {
 }
 
 void Board::update_transposition_table() {
-    quint64 current_zobrist = this->zobrist();
-    if(this->transpositionTable->contains(current_zobrist)) {
-        int cnt = this->transpositionTable->value(current_zobrist);
-        this->transpositionTable->insert(current_zobrist, cnt+1);
-    } else {
-        this->transpositionTable->insert(current_zobrist, 1);
-    }
+    this->transpositionTable->append(this->zobrist());
 }
 
 quint64 Board::zobrist() {
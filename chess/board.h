@@ -25,7 +25,9 @@
 #include <cstdint>
 #include <QRegularExpression>
 #include <QMap>
+#include <QVector>
 #include "move.h"
+#include "arena.h"
 
 namespace chess {
 
@@ -62,34 +64,6 @@ const uint8_t INIT_POS[120] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
 };
 
-// attack table
-// the index of this array corresponds to the distance
-// between two squares of the board (note the board is
-// encoded as a one dim array of size 120, where A1 = 21, H1 = 28
-// A8 = 91, A8 = 98.
-// the value denotes whether an enemy rook, biship knight, queen, king
-// on one square can attack the other square. The following encoding
-// is used:
-// Bitposition    Piece
-// 0              Knight
-// 1              Bishop
-// 2              Rook
-// 3              Queen
-// 4              King
-// e.g. distance one, i.e. index 1 (=left, up, down, right square) has
-// value 0x1C = MSB 00011100 LSB, i.e. king, queen, rook can
-// potentially attack
-const uint8_t ATTACK_TABLE[78] = {
-    0x00, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x01, 0x1a,
-    0x1C, 0x1A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x01,
-    0x0C, 0x01, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x0A, 0x0a, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x0a, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A
-};
-
 const uint8_t IDX_BPAWN = 0;
 const uint8_t IDX_WPAWN = 1;
 const uint8_t IDX_KNIGHT = 2;
@@ -102,8 +76,9 @@ const uint8_t IDX_KING = 6;
 // [piece_type[0] is DCOUNT (as in Byte Magazine paper)
 // [piece_type[1] ... [piece_type][4] resp.
 // [piece_type[1] ... [piece_type][8] contain
-// DPOINT table
-const int8_t DIR_TABLE[7][9] = {
+// DPOINT table. per square target lists and rays derived from it
+// are generated in board_tables.h
+constexpr int8_t DIR_TABLE[7][9] = {
     { 4, -10, -20, -11, -9 ,   0,   0,   0,   0 }, // max 4 black pawn directions, rest 0's
     { 4, +10, +20, +11, +9 ,   0,   0,   0,   0 }, // max 4 white pawn directions, rest 0's
     { 8, -21, -12, +8 , +19, +21, +12, -8, -19 }, // 8 knight directions
@@ -129,6 +104,13 @@ const uint8_t CASTLE_WQUEEN_POS = 1;
 const uint8_t CASTLE_BKING_POS = 2;
 const uint8_t CASTLE_BQUEEN_POS = 3;
 
+// longest san of a move including suffix, e.g. Qa1xb2+ or exd8=Q#
+const int SAN_MAX_LENGTH = 8;
+
+// longest fen written by Board::fen(char*): 64 pieces, 7 slashes,
+// turn, castling rights, e.p. target and two ten digit numbers w/ sign
+const int FEN_MAX_LENGTH = 128;
+
 const QString STARTING_FEN = QString("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
 
 // board positions
@@ -223,6 +205,34 @@ const QRegularExpression SAN_REGEX = QRegularExpression("^([NBKRQ])?([a-h])?([1-
 
 typedef QList<Move> Moves;
 
+// complete position of a board (pieces, side to move, castling
+// rights, en passent target and move counters). used to store
+// and later restore positions without allocating a new board
+struct BoardState
+{
+    uint8_t board[120];
+    bool turn;
+    uint8_t castling_rights;
+    uint8_t en_passent_target;
+    int halfmove_clock;
+    int fullmove_number;
+    bool last_was_null;
+};
+
+// what is needed to take back a move: the move, the piece it captured
+// and the square it stood on (different from the target for en passent),
+// and those parts of the position that can't be derived from the move
+struct UndoRecord
+{
+    Move move;
+    uint8_t captured;
+    uint8_t captured_at;
+    uint8_t castling_rights;
+    uint8_t en_passent_target;
+    int halfmove_clock;
+    bool last_was_null;
+};
+
 class Board
 {
 
@@ -268,6 +278,15 @@ public:
      */
     Board(const QString &fen_string);
 
+    /**
+     * @brief Board same as above for a latin1 encoded FEN string. Throws
+     *              std::invalid_argument with the same messages for invalid
+     *              strings, but reads the bytes directly
+     * @param fen FEN string, needs not to be null terminated
+     * @param len length of fen in bytes
+     */
+    Board(const char *fen, int len);
+
     /**
      * @brief Board creates new Board copying position of the pieces of the supplied
      *              board. Parameters (i.e. undo history, move numbers etc. are _not_
@@ -287,6 +306,14 @@ public:
      */
     QString fen();
 
+    /**
+     * @brief fen writes the FEN string of current board into out, which must
+     *            have room for at least FEN_MAX_LENGTH bytes
+     * @param out target buffer, not null terminated
+     * @return number of bytes written
+     */
+    int fen(char *out);
+
     /**
      * @brief copy_and_apply applies move and returns a deep copy of current board
      *        no check of legality. always call board.is_legal(m) before applying move
@@ -295,6 +322,15 @@ public:
      */
     Board* copy_and_apply(const Move &m);
 
+    /**
+     * @brief copy_and_apply same as above, but the copy is created in arena
+     *        and must not be deleted
+     * @param m move to apply
+     * @param arena arena that owns the copy
+     * @return copy of board
+     */
+    Board* copy_and_apply(const Move &m, Arena *arena);
+
     /**
      * @brief apply applies supplied move. doesn't check for legality
      *        no check of legality. always call board.is_legal(m) before applying move
@@ -302,6 +338,15 @@ public:
      */
     void apply(const Move &m);
 
+    /**
+     * @brief apply_and_record applies supplied move and adds the resulting
+     *        position to the transposition table, i.e. afterwards the board
+     *        is in the same state as a board returned by copy_and_apply(m).
+     *        no check of legality.
+     * @param m move to apply
+     */
+    void apply_and_record(const Move &m);
+
     /**
      * @brief undo undoes the very last move. undoing can only be done once for the very
      *             last move that was applied before, i.e. apply undo apply undo is ok,
@@ -310,6 +355,43 @@ public:
      */
     void undo();
 
+    /**
+     * @brief make applies supplied move like apply(), and pushes what is needed
+     *             to take it back onto the undo stack of the board. moves made
+     *             with make() can be taken back to any depth with unmake(),
+     *             without copying the board. no check of legality
+     * @param m move to make
+     */
+    void make(const Move &m);
+
+    /**
+     * @brief unmake takes back the last move made with make(). throws
+     *               logic error if there is none. a balanced sequence of make()
+     *               and unmake() doesn't affect undo() of a move applied before
+     * @return the move that was taken back
+     */
+    Move unmake();
+
+    /**
+     * @brief make_depth number of moves made with make() that can still be unmade
+     * @return size of the undo stack
+     */
+    int make_depth();
+
+    /**
+     * @brief save_state stores the current position into state.
+     *                   the transposition table is not part of the state
+     * @param state target of the copy
+     */
+    void save_state(BoardState *state);
+
+    /**
+     * @brief restore_state sets the board to the position stored
+     *                      in state. clears the undo history
+     * @param state position previously stored with save_state()
+     */
+    void restore_state(const BoardState &state);
+
     /**
      * @brief pseudo_legal_moves returns move list with all pseudo-legal moves of
      *                           current position
@@ -395,6 +477,17 @@ public:
      */
     QString san(const Move &m);
 
+    /**
+     * @brief san_body writes the standard algebraic notation of the supplied move
+     *        without the check or checkmate suffix as latin1 characters into out,
+     *        which must have room for at least SAN_MAX_LENGTH characters. the
+     *        supplied move MUST be legal on this board
+     * @param m Move to get the san for
+     * @param out target buffer, not null terminated
+     * @return number of characters written
+     */
+    int san_body(const Move &m, char *out);
+
     /**
      * @brief parse_san Given board position and san string, parses the san string
      *        and computes a move for it. Throws std::invalid_argument if the
@@ -615,9 +708,16 @@ private:
      */
     uint8_t board[120];
     /**
-     * @brief old_board stores the previous position for undo()
+     * @brief last_undo takes back the move of the last apply() on undo()
+     */
+    UndoRecord last_undo;
+    /**
+     * @brief undo_stack records of the moves made with make(), the first
+     * undo_depth of them are in use. it is never shrunk, so that making
+     * moves doesn't allocate once a line of that length has been seen
      */
-    uint8_t old_board[120];
+    QVector<UndoRecord> undo_stack;
+    int undo_depth;
 
     /**
      * @brief turn is either WHITE or BLACK
@@ -631,32 +731,48 @@ private:
      * and CASTLE_BQUEEN_POS
      */
     uint8_t castling_rights;
-    uint8_t prev_castling_rights;
 
     uint8_t en_passent_target;
-    uint8_t prev_en_passent_target;
-
-    int prev_halfmove_clock;
 
     bool is_empty(uint8_t idx);
     bool is_offside(uint8_t idx);
     bool is_white_at(uint8_t idx);
     bool is_attacked(int idx, bool attacker_color);
+    /**
+     * @brief the work of is_attacked, pseudo_legal_moves_from and apply
+     * is done by these specializations on the colour of the attacker
+     * resp. the side that moves, so that pawn directions, promotion
+     * ranks and castling squares are known at compile time
+     */
+    template<bool attacker_color> bool is_attacked_by(int idx);
+    template<bool color> void pseudo_legal_moves_of(int from_square, bool with_castles, Moves *moves);
+    template<bool color> void castling_moves_of(int king, Moves *moves);
+    template<bool color> void apply_move(const Move &m, UndoRecord *undo);
+    template<bool color> void unmake_move(const UndoRecord &undo);
+    void do_move(const Move &m, UndoRecord *undo);
+    void undo_move(const UndoRecord &undo);
     bool castles_wking(const Move &m);
     bool castles_bking(const Move &m);
     bool castles_wqueen(const Move &m);
     bool castles_bqueen(const Move &m);
     uint8_t piece_from_symbol(QChar c);
+    uint8_t piece_from_symbol(char c);
+    void init_from_fen(const char *fen, int len);
+    int fen_number(const char *s, int len);
     QChar piece_to_symbol(uint8_t idx);
     QString idx_to_str(int idx);
     uint8_t alpha_to_pos(QChar alpha);
 
-    QMap<quint64, int> *transpositionTable;
+    // zobrist hashes of all positions recorded so far, in order. a flat
+    // array, so that copying and releasing it per board is one allocation
+    QVector<quint64> *transpositionTable;
 
     int zobrist_piece_type(uint8_t piece);
 
     void update_transposition_table();
 
+    void copy_and_apply_into(Board *b, const Move &m);
+
     friend std::ostream& operator<<(std::ostream& strm, const Board &b);
 
 };
@@ -0,0 +1,152 @@
+#ifndef BOARD_TABLES_H
+#define BOARD_TABLES_H
+
+#include <cstdint>
+#include "board.h"
+
+namespace chess {
+
+// lookup tables of the 10x12 mailbox of Board (a1 is 21, h1 is 28,
+// a8 is 91 and h8 is 98), generated at compile time from DIR_TABLE.
+// only meant for board.cpp. c++11 constexpr functions consist of a
+// single return statement, so everything is written as recursion
+
+// fixed size array that can be returned from a constexpr function
+template<typename T, int N> struct Table {
+    T v[N];
+    constexpr const T& operator[](int i) const { return v[i]; }
+};
+
+// 0, 1, .., N-1 as a template parameter pack
+template<int... Is> struct Seq {};
+template<int N, int... Is> struct MakeSeq : MakeSeq<N-1, N-1, Is...> {};
+template<int... Is> struct MakeSeq<0, Is...> { typedef Seq<Is...> type; };
+
+constexpr bool on_board(int idx) {
+    return idx >= 21 && idx <= 98 && idx % 10 != 0 && idx % 10 != 9;
+}
+
+// file and rank 0..7 of a square, 0xFF for the fringe
+constexpr uint8_t square_file(int idx) {
+    return on_board(idx) ? uint8_t(idx % 10 - 1) : 0xFF;
+}
+
+constexpr uint8_t square_rank(int idx) {
+    return on_board(idx) ? uint8_t(idx / 10 - 2) : 0xFF;
+}
+
+// number of squares from idx to the edge of the board in direction dir
+constexpr int ray_length(int idx, int dir) {
+    return on_board(idx + dir) ? 1 + ray_length(idx + dir, dir) : 0;
+}
+
+// k-th square (from 0) of the ray from idx in direction dir, 0 after its end
+constexpr uint8_t ray_square(int idx, int dir, int k) {
+    return on_board(idx) && k < ray_length(idx, dir) ? uint8_t(idx + (k + 1) * dir) : 0;
+}
+
+// n-th square (from 0) of the targets of piece p on idx that are on the
+// board, looking at directions j and following of DIR_TABLE[p]. 0 if none
+constexpr uint8_t step_target(int idx, int p, int n, int j) {
+    return !on_board(idx) || j > DIR_TABLE[p][0] ? 0 :
+           !on_board(idx + DIR_TABLE[p][j]) ? step_target(idx, p, n, j + 1) :
+           n > 0 ? step_target(idx, p, n - 1, j + 1) : uint8_t(idx + DIR_TABLE[p][j]);
+}
+
+// bits of the pieces that can attack a square at distance d as described
+// for ATTACK_TABLE below. a slider can be at most seven steps away
+constexpr uint8_t attack_bits(int d) {
+    return uint8_t(
+        ((d == 8 || d == 12 || d == 19 || d == 21) ? 0x01 : 0x00) |
+        (d > 0 && ((d % 9 == 0 && d / 9 <= 7) || (d % 11 == 0 && d / 11 <= 7)) ? 0x0A : 0x00) |
+        (d > 0 && ((d % 10 == 0 && d / 10 <= 7) || d <= 7) ? 0x0C : 0x00) |
+        ((d == 1 || d == 9 || d == 10 || d == 11) ? 0x10 : 0x00));
+}
+
+template<int... Is>
+constexpr Table<uint8_t, 120> make_files(Seq<Is...>) {
+    return Table<uint8_t, 120>{{ square_file(Is)... }};
+}
+
+template<int... Is>
+constexpr Table<uint8_t, 120> make_ranks(Seq<Is...>) {
+    return Table<uint8_t, 120>{{ square_rank(Is)... }};
+}
+
+template<int... Is>
+constexpr Table<uint8_t, 64> make_squares(Seq<Is...>) {
+    return Table<uint8_t, 64>{{ uint8_t((Is / 8 + 2) * 10 + Is % 8 + 1)... }};
+}
+
+template<int... Ks>
+constexpr Table<uint8_t, 9> make_targets(int idx, int p, Seq<Ks...>) {
+    return Table<uint8_t, 9>{{ step_target(idx, p, Ks, 1)... }};
+}
+
+template<int... Is>
+constexpr Table<Table<uint8_t, 9>, 120> make_target_table(int p, Seq<Is...>) {
+    return Table<Table<uint8_t, 9>, 120>{{ make_targets(Is, p, MakeSeq<9>::type())... }};
+}
+
+template<int... Ks>
+constexpr Table<uint8_t, 8> make_ray(int idx, int dir, Seq<Ks...>) {
+    return Table<uint8_t, 8>{{ ray_square(idx, dir, Ks)... }};
+}
+
+template<int... Js>
+constexpr Table<Table<uint8_t, 8>, 8> make_rays(int idx, Seq<Js...>) {
+    return Table<Table<uint8_t, 8>, 8>{{ make_ray(idx, DIR_TABLE[IDX_QUEEN][Js + 1], MakeSeq<8>::type())... }};
+}
+
+template<int... Is>
+constexpr Table<Table<Table<uint8_t, 8>, 8>, 120> make_ray_table(Seq<Is...>) {
+    return Table<Table<Table<uint8_t, 8>, 8>, 120>{{ make_rays(Is, MakeSeq<8>::type())... }};
+}
+
+template<int... Is>
+constexpr Table<uint8_t, 78> make_attack_table(Seq<Is...>) {
+    return Table<uint8_t, 78>{{ attack_bits(Is)... }};
+}
+
+// file and rank 0..7 of a square, 0xFF for the fringe
+constexpr Table<uint8_t, 120> SQUARE_FILE = make_files(MakeSeq<120>::type());
+constexpr Table<uint8_t, 120> SQUARE_RANK = make_ranks(MakeSeq<120>::type());
+
+// square of x + 8 * y for x, y in 0..7
+constexpr Table<uint8_t, 64> SQUARE_AT = make_squares(MakeSeq<64>::type());
+
+// squares a knight resp. king on a square can go to, terminated by 0
+constexpr Table<Table<uint8_t, 9>, 120> KNIGHT_TARGETS = make_target_table(IDX_KNIGHT, MakeSeq<120>::type());
+constexpr Table<Table<uint8_t, 9>, 120> KING_TARGETS = make_target_table(IDX_KING, MakeSeq<120>::type());
+
+// squares along the eight queen directions of DIR_TABLE from a square up
+// to the edge of the board, terminated by 0. rays 0..3 are diagonal (in
+// the order of the bishop directions), rays 4..7 straight (rook order)
+constexpr Table<Table<Table<uint8_t, 8>, 8>, 120> RAYS = make_ray_table(MakeSeq<120>::type());
+
+// attack table
+// the index of this array corresponds to the distance between two
+// squares of the board. the value denotes whether an enemy rook, bishop,
+// knight, queen, king on one square can attack the other square:
+// Bitposition    Piece
+// 0              Knight
+// 1              Bishop
+// 2              Rook
+// 3              Queen
+// 4              King
+// e.g. distance one (left, up, down, right square) has value 0x1C,
+// i.e. king, queen, rook can potentially attack
+constexpr Table<uint8_t, 78> ATTACK_TABLE = make_attack_table(MakeSeq<78>::type());
+
+static_assert(KNIGHT_TARGETS[21][0] == 42 && KNIGHT_TARGETS[21][1] == 33 && KNIGHT_TARGETS[21][2] == 0,
+              "knight targets of a1 are b3, c2");
+static_assert(KING_TARGETS[55][8] == 0 && KING_TARGETS[28][3] == 0,
+              "king targets of e4 resp. h1");
+static_assert(RAYS[21][1][6] == 98 && RAYS[21][1][7] == 0 && RAYS[21][0][0] == 0,
+              "diagonal from a1 to h8");
+static_assert(ATTACK_TABLE[1] == 0x1C && ATTACK_TABLE[9] == 0x1A && ATTACK_TABLE[77] == 0x0A,
+              "attack bits of king, bishop and queen distances");
+
+}
+
+#endif // BOARD_TABLES_H
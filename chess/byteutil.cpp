@@ -43,3 +43,14 @@ void chess::ByteUtil::prepend_as_uint64(QByteArray* ba, quint64 r) {
     chess::ByteUtil::prepend_as_uint32(ba, quint32(r>>32));
 }
 
+quint16 chess::ByteUtil::read_as_uint16(const uint8_t *data) {
+    return quint16((quint16(data[0]) << 8) | data[1]);
+}
+
+quint32 chess::ByteUtil::read_as_uint32(const uint8_t *data) {
+    return (quint32(chess::ByteUtil::read_as_uint16(data)) << 16) | chess::ByteUtil::read_as_uint16(data + 2);
+}
+
+quint64 chess::ByteUtil::read_as_uint64(const uint8_t *data) {
+    return (quint64(chess::ByteUtil::read_as_uint32(data)) << 32) | chess::ByteUtil::read_as_uint32(data + 4);
+}
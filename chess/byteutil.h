@@ -2,6 +2,7 @@
 #define BYTEUTIL_H
 
 #include <QByteArray>
+#include <stdint.h>
 
 namespace chess {
 
@@ -18,6 +19,11 @@ public:
     static void prepend_as_uint16(QByteArray* ba, quint16 val);
     static void prepend_as_uint32(QByteArray* ba, quint32 val);
     static void prepend_as_uint64(QByteArray* ba, quint64 val);
+
+    // big endian, as written by the functions above
+    static quint16 read_as_uint16(const uint8_t *data);
+    static quint32 read_as_uint32(const uint8_t *data);
+    static quint64 read_as_uint64(const uint8_t *data);
 };
 
 }
@@ -4,9 +4,16 @@
 #include "chess/dcgencoder.h"
 #include "chess/dcgdecoder.h"
 #include "chess/byteutil.h"
+#include "chess/batchfetch.h"
+#include "chess/gamecursor.h"
 #include "assert.h"
+#include <string.h>
 #include <iostream>
+#include <algorithm>
 #include <QFile>
+#include <QThread>
+#include <QThreadPool>
+#include <QMapIterator>
 #include <QDataStream>
 #include <QDebug>
 
@@ -18,6 +25,8 @@ chess::Database::Database(QString &filename)
     this->filenameNames = QString(filename).append(".dcn");
     this->filenameSites = QString(filename).append(".dcs");
     this->filenameEvents = QString(filename).append(".dce");
+    this->filenameJournal = QString(filename).append(".dcj");
+    this->filenameCompact = QString(filename).append(".dcx");
     this->magicNameString = QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x6e");   
     this->magicIndexString = QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x69");
     this->magicGamesString = QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x67");
@@ -27,12 +36,27 @@ chess::Database::Database(QString &filename)
     this->offsetNames = new QMap<quint32, QString>();
     this->offsetSites = new QMap<quint32, QString>();
     this->offsetEvents = new QMap<quint32, QString>();
+    this->nameOffsets = new QHash<QString, quint32>();
+    this->siteOffsets = new QHash<QString, quint32>();
+    this->eventOffsets = new QHash<QString, quint32>();
     this->dcgencoder = new chess::DcgEncoder();
-    this->dcgdecoder = new chess::DcgDecoder();
+    this->decoders = new QList<chess::DcgDecoder*>();
     this->pgnreader = new chess::PgnReader();
+    this->pgntranscoder = new chess::PgnTranscoder();
 
     this->loadUponOpen = 0;
-        
+    this->boardCheckpoints = 0;
+    this->gamesFile = new QFile(this->filenameGames);
+    this->gamesMap = 0;
+    this->gamesMapSize = 0;
+    this->mutex = new QMutex();
+    // disabled until setGameCacheSize() is called
+    this->gameCache = new QCache<int, FlatGame>(0);
+    this->cacheHits = 0;
+    this->cacheMisses = 0;
+    this->recordStarts = new QVector<quint64>();
+    this->batchThreads = QThread::idealThreadCount();
+
     this->indices = new QList<chess::IndexEntry*>();
 }
 
@@ -44,16 +68,66 @@ chess::Database::~Database()
     delete this->offsetNames;
     delete this->offsetSites;
     delete this->offsetEvents;
+    delete this->nameOffsets;
+    delete this->siteOffsets;
+    delete this->eventOffsets;
     delete this->dcgencoder;
-    delete this->dcgdecoder;
+    for(int i=0;i<this->decoders->size();i++) {
+        delete this->decoders->at(i);
+    }
+    delete this->decoders;
     delete this->pgnreader;
+    delete this->pgntranscoder;
     delete this->indices;
+    this->unmapGames();
+    delete this->gamesFile;
+    delete this->gameCache;
+    delete this->recordStarts;
+    delete this->mutex;
+}
+
+bool chess::Database::mapGames() {
+    if(this->gamesMap != 0) {
+        return true;
+    }
+    if(!this->gamesFile->open(QFile::ReadOnly)) {
+        return false;
+    }
+    qint64 size = this->gamesFile->size();
+    if(size > 0) {
+        this->gamesMap = this->gamesFile->map(0, size);
+    }
+    if(this->gamesMap == 0) {
+        this->gamesFile->close();
+        return false;
+    }
+    this->gamesMapSize = size;
+    return true;
+}
+
+void chess::Database::unmapGames() {
+    if(this->gamesMap != 0) {
+        this->gamesFile->unmap(this->gamesMap);
+        this->gamesMap = 0;
+        this->gamesMapSize = 0;
+    }
+    if(this->gamesFile->isOpen()) {
+        this->gamesFile->close();
+    }
 }
 
 
 void chess::Database::loadIndex() {
 
     this->indices->clear();
+    this->clearGameCache();
+    this->recordStarts->clear();
+    this->finishCompact();
+    ImportJournal journal(this->filenameJournal);
+    this->recoverImport(&journal);
+    // the games are read from the mapping from now on. if the file
+    // can't be mapped, each lookup falls back to reading the record
+    this->mapGames();
     QFile dciFile;
     dciFile.setFileName(this->filenameIndex);
     if(!dciFile.exists()) {
@@ -120,10 +194,9 @@ void chess::Database::loadIndex() {
             qDebug() << "eloBlack: " << entry_i->eloBlack;
             ds_entry_i >> entry_i->result;
             qDebug() << "result: " << entry_i->result;
-            char *eco = new char[sizeof "A00"];
-            ds_entry_i.readRawData(eco, 3);
-            entry_i->eco = eco;
-            qDebug() << QString::fromLocal8Bit(eco);
+            ds_entry_i.readRawData(entry_i->eco, 3);
+            entry_i->eco[3] = 0;
+            qDebug() << QString::fromLocal8Bit(entry_i->eco);
             ds_entry_i >> entry_i->year;
             ds_entry_i >> entry_i->month;
             ds_entry_i >> entry_i->day;
@@ -139,6 +212,7 @@ void chess::Database::loadIndex() {
 
 void chess::Database::loadSites() {
     this->offsetSites->clear();
+    this->siteOffsets->clear();
     // for name file and site file build QMaps to quickly
     // access the data
     // read index file into QList of IndexEntries
@@ -173,6 +247,7 @@ void chess::Database::loadSites() {
 
 void chess::Database::loadEvents() {
     this->offsetEvents->clear();
+    this->eventOffsets->clear();
     // for events file and site file build QMaps to quickly
     // access the data
     // read index file into QList of IndexEntries
@@ -208,36 +283,36 @@ void chess::Database::loadEvents() {
 
 
 
+void chess::Database::setBoardCheckpoints(int plies) {
+    this->boardCheckpoints = plies;
+}
+
 int chess::Database::countGames() {
     return this->indices->length();
 }
 
-chess::Game* chess::Database::getGameAt(int i) {
-
-    if(i >= this->indices->size()) {
-        return 0; // maybe throw out of range error or something instead of silently failing
+chess::IndexEntry* chess::Database::getIndexEntry(int i) {
+    if(i < 0 || i >= this->indices->size()) {
+        return 0;
     }
-    chess::IndexEntry *ie = this->indices->at(i);
-    if(ie->deleted) {
-        // todo: jump to next valid entry
-    }
-    chess::Game* game = new chess::Game();
+    return this->indices->at(i);
+}
+
+int chess::Database::readHeaders(IndexEntry *ie, QMap<QString, QString> *headers) {
     QString whiteName = this->offsetNames->value(ie->whiteOffset);
     QString blackName = this->offsetNames->value(ie->blackOffset);
     QString site = this->offsetSites->value(ie->siteRef);
-    qDebug() << "EVENT REF: " << ie->eventRef;
     QString event = this->offsetEvents->value(ie->eventRef);
-    game->headers->insert("White",whiteName);
-    game->headers->insert("Black", blackName);
-    game->headers->insert("Site", site);
-    game->headers->insert("Event", event);
+    headers->insert("White",whiteName);
+    headers->insert("Black", blackName);
+    headers->insert("Site", site);
+    headers->insert("Event", event);
     if(ie->eloWhite != 0) {
-        game->headers->insert("WhiteElo", QString::number(ie->eloWhite));
+        headers->insert("WhiteElo", QString::number(ie->eloWhite));
     }
     if(ie->eloBlack != 0) {
-        game->headers->insert("BlackElo", QString::number(ie->eloBlack));
+        headers->insert("BlackElo", QString::number(ie->eloBlack));
     }
-    qDebug() << "EVENT IS: " << event;
     QString date("");
     if(ie->year != 0) {
         date.append(QString::number(ie->year).rightJustified(4,'0'));
@@ -256,42 +331,302 @@ chess::Game* chess::Database::getGameAt(int i) {
     } else {
         date.append("??");
     }
-    game->headers->insert("Date", date);
-    qDebug() << "RESULT: " << ie->result;
+    headers->insert("Date", date);
+    int result = RES_UNDEF;
     if(ie->result == RES_WHITE_WINS) {
-        game->headers->insert("Result", "1-0");
-        game->setResult(RES_WHITE_WINS);
+        headers->insert("Result", "1-0");
+        result = RES_WHITE_WINS;
     } else if(ie->result == RES_BLACK_WINS) {
-        game->headers->insert("Result", "0-1");
-        game->setResult(RES_BLACK_WINS);
+        headers->insert("Result", "0-1");
+        result = RES_BLACK_WINS;
     } else if(ie->result == RES_DRAW) {
-        game->headers->insert("Result", "1/2-1/2");
-        game->setResult(RES_DRAW);
+        headers->insert("Result", "1/2-1/2");
+        result = RES_DRAW;
     } else {
-        game->headers->insert("Result", "*");
-        game->setResult(RES_UNDEF);
+        headers->insert("Result", "*");
     }
-    game->headers->insert("ECO", ie->eco);
+    headers->insert("ECO", ie->eco);
     if(ie->round != 0) {
-        game->headers->insert("Round", QString::number((ie->round)));
+        headers->insert("Round", QString::number((ie->round)));
     } else {
-        game->headers->insert("Round", "?");
+        headers->insert("Round", "?");
     }
-    QFile fnGames(this->filenameGames);
-    if(fnGames.open(QFile::ReadOnly)) {
-        fnGames.seek(ie->gameOffset);
-        QDataStream gi(&fnGames);
-        int length = this->decodeLength(&gi);
-        QByteArray game_raw;
-        game_raw.resize(length);
-        game_raw.fill(char(0x20));
-        gi.readRawData(game_raw.data(), length);
-        qDebug() << "length" << length << " arr: " << game_raw.toHex();
-        this->dcgdecoder->decodeGame(game, &game_raw);
+    return result;
+}
+
+chess::Game* chess::Database::getGameAt(int i) {
+
+    if(i < 0 || i >= this->indices->size()) {
+        return 0; // maybe throw out of range error or something instead of silently failing
+    }
+    chess::IndexEntry *ie = this->indices->at(i);
+    if(ie->deleted) {
+        // todo: jump to next valid entry
     }
+    chess::Game* game = new chess::Game();
+    game->setBoardCheckpoints(this->boardCheckpoints);
+    game->setResult(this->readHeaders(ie, game->headers));
+    QByteArray buffer;
+    size_t length = 0;
+    DcgDecoder *decoder = this->acquireDecoder();
+    try {
+        const uint8_t *record = this->gameRecord(ie, decoder, &length, &buffer);
+        if(record != 0) {
+            decoder->decodeGame(game, record, length);
+        }
+    } catch(std::invalid_argument a) {
+        this->releaseDecoder(decoder);
+        delete game;
+        throw;
+    }
+    this->releaseDecoder(decoder);
     return game;
 }
 
+chess::FlatGame* chess::Database::getFlatGameAt(int i, FlatGame *g) {
+
+    if(i < 0 || i >= this->indices->size()) {
+        return 0;
+    }
+    chess::IndexEntry *ie = this->indices->at(i);
+    {
+        QMutexLocker lock(this->mutex);
+        if(this->gameCache->maxCost() > 0) {
+            FlatGame *cached = this->gameCache->object(i);
+            if(cached != 0) {
+                this->cacheHits++;
+                g->assign(cached);
+                return g;
+            }
+            this->cacheMisses++;
+        }
+    }
+    QByteArray buffer;
+    size_t length = 0;
+    DcgDecoder *decoder = this->acquireDecoder();
+    try {
+        const uint8_t *record = this->gameRecord(ie, decoder, &length, &buffer);
+        if(record != 0) {
+            decoder->decodeGame(g, record, length);
+        } else {
+            g->clear();
+        }
+    } catch(std::invalid_argument a) {
+        this->releaseDecoder(decoder);
+        throw;
+    }
+    this->releaseDecoder(decoder);
+    g->setResult(this->readHeaders(ie, g->headers));
+    QMutexLocker lock(this->mutex);
+    if(this->gameCache->maxCost() > 0) {
+        FlatGame *copy = new FlatGame();
+        copy->assign(g);
+        // takes ownership, deletes copy if it exceeds the budget
+        this->gameCache->insert(i, copy, copy->memoryUsage());
+    }
+    return g;
+}
+
+QList<chess::Game*>* chess::Database::getGamesAt(const QList<int> &ids) {
+    QVector<Game*> games(ids.size(), 0);
+    this->fetchBatch(ids, &games, 0);
+    return new QList<Game*>(games.toList());
+}
+
+QList<chess::FlatGame*>* chess::Database::getFlatGamesAt(const QList<int> &ids) {
+    QVector<FlatGame*> games(ids.size(), 0);
+    this->fetchBatch(ids, 0, &games);
+    return new QList<FlatGame*>(games.toList());
+}
+
+void chess::Database::setBatchThreads(int n) {
+    this->batchThreads = n > 0 ? n : 1;
+}
+
+static bool batchItemBefore(const chess::BatchItem &a, const chess::BatchItem &b) {
+    return a.offset < b.offset;
+}
+
+quint64 chess::Database::recordEnd(quint64 offset) {
+    QVector<quint64>::const_iterator next = std::upper_bound(this->recordStarts->constBegin(),
+                                                              this->recordStarts->constEnd(), offset);
+    if(next == this->recordStarts->constEnd()) {
+        return offset;
+    }
+    return *next;
+}
+
+void chess::Database::fetchBatch(const QList<int> &ids, QVector<Game*> *games, QVector<FlatGame*> *flatGames) {
+    {
+        QMutexLocker lock(this->mutex);
+        if(this->recordStarts->isEmpty() && !this->indices->isEmpty()) {
+            this->recordStarts->reserve(this->indices->size() + 1);
+            for(int i=0;i<this->indices->size();i++) {
+                this->recordStarts->append(this->indices->at(i)->gameOffset);
+            }
+            std::sort(this->recordStarts->begin(), this->recordStarts->end());
+            this->recordStarts->append(quint64(QFile(this->filenameGames).size()));
+        }
+    }
+    QVector<BatchItem> items;
+    items.reserve(ids.size());
+    for(int s=0;s<ids.size();s++) {
+        int i = ids.at(s);
+        if(i < 0 || i >= this->indices->size()) {
+            continue;
+        }
+        BatchItem item;
+        item.index = i;
+        item.slot = s;
+        item.offset = this->indices->at(i)->gameOffset;
+        item.end = this->recordEnd(item.offset);
+        items.append(item);
+    }
+    if(items.isEmpty()) {
+        return;
+    }
+    // visit the file front to back, and merge records that are
+    // (nearly) adjacent into one read
+    std::sort(items.begin(), items.end(), batchItemBefore);
+    QVector<BatchRead> reads;
+    quint64 total = 0;
+    for(int j=0;j<items.size();j++) {
+        const BatchItem &item = items.at(j);
+        if(!reads.isEmpty()) {
+            BatchRead &read = reads.last();
+            if(item.offset <= read.end + BATCH_MAX_GAP && item.end - read.start <= BATCH_MAX_READ) {
+                if(item.end > read.end) {
+                    total += item.end - read.end;
+                    read.end = item.end;
+                }
+                read.last = j + 1;
+                continue;
+            }
+        }
+        BatchRead read;
+        read.start = item.offset;
+        read.end = item.end;
+        read.first = j;
+        read.last = j + 1;
+        reads.append(read);
+        total += item.end - item.offset;
+    }
+    // a few tasks of about equal size per thread, so that threads
+    // that finish early take over work of the others. each task
+    // keeps its reads in file order
+    int tasks = this->batchThreads * 4;
+    if(tasks > reads.size()) {
+        tasks = reads.size();
+    }
+    quint64 share = total / quint64(tasks) + 1;
+    // detach before the tasks write to the slots concurrently
+    if(games != 0) {
+        games->data();
+    } else {
+        flatGames->data();
+    }
+    QThreadPool pool;
+    pool.setMaxThreadCount(this->batchThreads);
+    int first = 0;
+    quint64 bytes = 0;
+    for(int r=0;r<reads.size();r++) {
+        bytes += reads.at(r).end - reads.at(r).start;
+        if(bytes >= share || r == reads.size() - 1) {
+            pool.start(new BatchFetchTask(this, &items, &reads, first, r + 1,
+                                          this->boardCheckpoints, games, flatGames));
+            first = r + 1;
+            bytes = 0;
+        }
+    }
+    pool.waitForDone();
+}
+
+chess::DcgDecoder* chess::Database::acquireDecoder() {
+    QMutexLocker lock(this->mutex);
+    if(this->decoders->isEmpty()) {
+        return new DcgDecoder();
+    }
+    return this->decoders->takeLast();
+}
+
+void chess::Database::releaseDecoder(DcgDecoder *decoder) {
+    QMutexLocker lock(this->mutex);
+    this->decoders->append(decoder);
+}
+
+const uint8_t* chess::Database::gameRecord(IndexEntry *ie, DcgDecoder *decoder, size_t *length, QByteArray *buffer) {
+    if(this->gamesMap != 0) {
+        // decode in place from the mapped file
+        if(qint64(ie->gameOffset) >= this->gamesMapSize) {
+            return 0;
+        }
+        const uint8_t *record = this->gamesMap + ie->gameOffset;
+        size_t available = size_t(this->gamesMapSize - ie->gameOffset);
+        size_t idx = 0;
+        *length = decoder->decodeLength(record, available, &idx);
+        return record + idx;
+    }
+    QFile fnGames(this->filenameGames);
+    if(!fnGames.open(QFile::ReadOnly)) {
+        return 0;
+    }
+    fnGames.seek(ie->gameOffset);
+    QDataStream gi(&fnGames);
+    int l = this->decodeLength(&gi);
+    if(l < 0 || l > fnGames.size() - fnGames.pos()) {
+        throw std::invalid_argument("game record exceeds .dcg file");
+    }
+    buffer->resize(l);
+    gi.readRawData(buffer->data(), l);
+    *length = size_t(l);
+    return reinterpret_cast<const uint8_t*>(buffer->constData());
+}
+
+void chess::Database::setGameCacheSize(int bytes) {
+    QMutexLocker lock(this->mutex);
+    this->gameCache->setMaxCost(bytes);
+}
+
+void chess::Database::invalidateGame(int i) {
+    QMutexLocker lock(this->mutex);
+    this->gameCache->remove(i);
+}
+
+void chess::Database::clearGameCache() {
+    QMutexLocker lock(this->mutex);
+    this->gameCache->clear();
+}
+
+int chess::Database::getCacheHits() {
+    QMutexLocker lock(this->mutex);
+    return this->cacheHits;
+}
+
+int chess::Database::getCacheMisses() {
+    QMutexLocker lock(this->mutex);
+    return this->cacheMisses;
+}
+
+QString chess::Database::getIndexFilename() {
+    return this->filenameIndex;
+}
+
+QString chess::Database::getGamesFilename() {
+    return this->filenameGames;
+}
+
+QString chess::Database::getName(quint32 offset) {
+    return this->offsetNames->value(offset);
+}
+
+QString chess::Database::getSite(quint32 offset) {
+    return this->offsetSites->value(offset);
+}
+
+QString chess::Database::getEvent(quint32 offset) {
+    return this->offsetEvents->value(offset);
+}
+
 int chess::Database::decodeLength(QDataStream *stream) {
     quint8 len1 = 0;
     *stream >> len1;
@@ -337,6 +672,7 @@ int chess::Database::decodeLength(QDataStream *stream) {
 void chess::Database::loadNames() {
 
     this->offsetNames->clear();
+    this->nameOffsets->clear();
     QFile dcnFile;
     dcnFile.setFileName(this->filenameNames);
     dcnFile.open(QFile::ReadOnly);
@@ -370,15 +706,462 @@ void chess::Database::importPgnAndSave(QString &pgnfile) {
     QMap<QString, quint32> *sites = new QMap<QString, quint32>();
     QMap<QString, quint32> *events = new QMap<QString, quint32>();
 
-    this->importPgnNamesSitesEvents(pgnfile, names, sites, events);
-    this->importPgnAppendSites(sites);
-    this->importPgnAppendNames(names);
-    this->importPgnAppendEvents(events);
-    this->importPgnAppendGamesIndices(pgnfile, names, sites, events);
+    // games are appended to the .dcg, drop the mapping of the old
+    // file. the games may be overwritten, so drop cached ones as well
+    this->unmapGames();
+    this->clearGameCache();
+
+    this->finishCompact();
+    ImportJournal journal(this->filenameJournal);
+    quint64 offset = 0;
+    bool ok = true;
+    if(this->recoverImport(&journal) && journal.getPgnFile() == pgnfile) {
+        // names, sites and events were complete before the first
+        // checkpoint, take their offsets from the files
+        offset = journal.getPgnOffset();
+        std::cout << "resuming import of " << pgnfile.toStdString() << " at " << offset << std::endl;
+        this->loadNames();
+        this->loadSites();
+        this->loadEvents();
+        QMapIterator<quint32, QString> n(*this->offsetNames);
+        while(n.hasNext()) {
+            n.next();
+            names->insert(n.value(), n.key());
+        }
+        QMapIterator<quint32, QString> s(*this->offsetSites);
+        while(s.hasNext()) {
+            s.next();
+            sites->insert(s.value(), s.key());
+        }
+        QMapIterator<quint32, QString> e(*this->offsetEvents);
+        while(e.hasNext()) {
+            e.next();
+            events->insert(e.value(), e.key());
+        }
+    } else {
+        // an interrupted import of another file keeps
+        // the games up to its last checkpoint
+        journal.finish();
+        ok = journal.begin(pgnfile, this->databaseFiles());
+        if(ok) {
+            this->importPgnNamesSitesEvents(pgnfile, names, sites, events);
+            this->importPgnAppendSites(sites);
+            this->importPgnAppendNames(names);
+            this->importPgnAppendEvents(events);
+            // the games refer to them, so they must be on disk first
+            for(int i=0;i<3 && ok;i++) {
+                QFile f(this->databaseFiles().at(i));
+                ok = f.open(QFile::Append) && ImportJournal::sync(&f);
+            }
+        }
+    }
+    if(ok && this->importPgnAppendGamesIndices(pgnfile, names, sites, events, &journal, offset)) {
+        journal.finish();
+    } else {
+        std::cerr << "Error: import interrupted, run it again to continue." << std::endl;
+    }
+    // the games are on disk now, read them from the mapping again
+    this->mapGames();
+
+    delete names;
+    delete sites;
+    delete events;
+}
+
+QStringList chess::Database::databaseFiles() {
+    QStringList files;
+    files << this->filenameNames << this->filenameSites << this->filenameEvents
+          << this->filenameIndex << this->filenameGames;
+    return files;
+}
+
+bool chess::Database::recoverImport(ImportJournal *journal) {
+    if(!journal->load()) {
+        // there is none, or it was cut off before anything was appended
+        journal->finish();
+        return false;
+    }
+    std::cout << "rolling back interrupted import of " << journal->getPgnFile().toStdString() << std::endl;
+    if(!journal->rollback(this->databaseFiles())) {
+        std::cerr << "Error: can't roll back interrupted import." << std::endl;
+    }
+    if(!journal->hasCheckpoint()) {
+        journal->finish();
+        return false;
+    }
+    return true;
+}
+
+bool chess::Database::hasPendingImport() {
+    return QFile::exists(this->filenameJournal);
+}
+
+bool chess::Database::checkNoPendingImport() {
+    if(this->hasPendingImport()) {
+        std::cerr << "Error: an interrupted import must be completed first." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// size of one entry of the name, site and event files
+const int DICTIONARY_ENTRY_SIZE = 36;
+
+bool chess::Database::compact() {
+
+    if(!this->checkNoPendingImport()) {
+        return false;
+    }
+
+    // the files are replaced, drop everything that refers to the old ones
+    this->unmapGames();
+    this->clearGameCache();
 
+    // first pass over the index: collect the names, sites and
+    // events still in use, and the new position of loadUponOpen
+    QSet<quint32> *usedNames = new QSet<quint32>();
+    QSet<quint32> *usedSites = new QSet<quint32>();
+    QSet<quint32> *usedEvents = new QSet<quint32>();
+    quint64 newLoadUponOpen = 0;
+    bool ok = true;
+    {
+        GameCursor cursor(this, true);
+        quint64 live = 0;
+        while(cursor.next()) {
+            IndexEntry *ie = cursor.entry();
+            usedNames->insert(ie->whiteOffset);
+            usedNames->insert(ie->blackOffset);
+            usedSites->insert(ie->siteRef);
+            usedEvents->insert(ie->eventRef);
+            if(quint64(cursor.index()) == this->loadUponOpen) {
+                newLoadUponOpen = live;
+            }
+            live++;
+        }
+        ok = !cursor.hasError();
+    }
+
+    QHash<quint32, quint32> *names = new QHash<quint32, quint32>();
+    QHash<quint32, quint32> *sites = new QHash<quint32, quint32>();
+    QHash<quint32, quint32> *events = new QHash<quint32, quint32>();
+    QFile fnNames(QString(this->filenameNames).append(".new"));
+    QFile fnSites(QString(this->filenameSites).append(".new"));
+    QFile fnEvents(QString(this->filenameEvents).append(".new"));
+    QFile fnIndex(QString(this->filenameIndex).append(".new"));
+    QFile fnGames(QString(this->filenameGames).append(".new"));
+    ok = ok && this->compactDictionary(this->filenameNames, this->magicNameString, usedNames, names, &fnNames);
+    ok = ok && this->compactDictionary(this->filenameSites, this->magicSitesString, usedSites, sites, &fnSites);
+    ok = ok && this->compactDictionary(this->filenameEvents, this->magicEventString, usedEvents, events, &fnEvents);
+    ok = ok && fnIndex.open(QFile::WriteOnly | QFile::Truncate)
+            && fnGames.open(QFile::WriteOnly | QFile::Truncate);
+
+    // second pass: copy the live games and write their index
+    // entries with the new offsets, both in large blocks
+    if(ok) {
+        QByteArray indexBlock;
+        indexBlock.append(this->magicIndexString);
+        indexBlock.append(this->version);
+        ByteUtil::append_as_uint64(&indexBlock, newLoadUponOpen);
+        QByteArray gameBlock;
+        gameBlock.reserve(GAME_BLOCK_SIZE + 65536);
+        gameBlock.append(this->magicGamesString);
+        quint64 gamesPos = 0;
+        GameCursor cursor(this);
+        while(ok && cursor.next()) {
+            IndexEntry *ie = cursor.entry();
+            ie->gameOffset = gamesPos + gameBlock.size();
+            ie->whiteOffset = names->value(ie->whiteOffset);
+            ie->blackOffset = names->value(ie->blackOffset);
+            ie->siteRef = sites->value(ie->siteRef);
+            ie->eventRef = events->value(ie->eventRef);
+            ie->write(&indexBlock);
+            gameBlock.append(reinterpret_cast<const char*>(cursor.rawRecord()), int(cursor.rawRecordSize()));
+            if(gameBlock.size() >= GAME_BLOCK_SIZE) {
+                ok = fnGames.write(gameBlock) == gameBlock.size();
+                gamesPos += gameBlock.size();
+                gameBlock.resize(0);
+            }
+            if(ok && indexBlock.size() >= GAME_BLOCK_SIZE) {
+                ok = fnIndex.write(indexBlock) == indexBlock.size();
+                indexBlock.resize(0);
+            }
+        }
+        ok = ok && !cursor.hasError();
+        ok = ok && fnGames.write(gameBlock) == gameBlock.size();
+        ok = ok && fnIndex.write(indexBlock) == indexBlock.size();
+    }
+
+    // all new files must be on disk before the marker is, since
+    // from then on they replace the old ones even after a crash
+    ok = ok && ImportJournal::sync(&fnNames) && ImportJournal::sync(&fnSites)
+            && ImportJournal::sync(&fnEvents) && ImportJournal::sync(&fnIndex)
+            && ImportJournal::sync(&fnGames);
+    fnNames.close();
+    fnSites.close();
+    fnEvents.close();
+    fnIndex.close();
+    fnGames.close();
+    if(ok) {
+        QFile marker(this->filenameCompact);
+        ok = marker.open(QFile::WriteOnly | QFile::Truncate) && ImportJournal::sync(&marker);
+        marker.close();
+    }
+    if(ok) {
+        if(!this->finishCompact()) {
+            std::cerr << "Error: compacted database could only be partially replaced, "
+                         "it is completed when the database is opened next." << std::endl;
+            ok = false;
+        }
+    } else {
+        std::cerr << "Error: can't compact database." << std::endl;
+        // no marker, this removes the new files
+        this->finishCompact();
+    }
+
+    delete usedNames;
+    delete usedSites;
+    delete usedEvents;
     delete names;
     delete sites;
     delete events;
+
+    this->loadIndex();
+    this->loadNames();
+    this->loadSites();
+    this->loadEvents();
+    return ok;
+}
+
+bool chess::Database::compactDictionary(const QString &filename, const QByteArray &magic, QSet<quint32> *used,
+                                        QHash<quint32, quint32> *offsets, QFile *out) {
+    if(!out->open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+    QByteArray block;
+    block.append(magic);
+    quint32 written = 0;
+    bool ok = true;
+    QFile in(filename);
+    if(in.open(QFile::ReadOnly)) {
+        QByteArray chunk;
+        quint32 pos = quint32(magic.size());
+        in.seek(pos);
+        while(ok && !(chunk = in.read(DICTIONARY_ENTRY_SIZE * 4096)).isEmpty()) {
+            for(int i=0;i+DICTIONARY_ENTRY_SIZE<=chunk.size();i+=DICTIONARY_ENTRY_SIZE) {
+                if(used->contains(pos)) {
+                    offsets->insert(pos, written + quint32(block.size()));
+                    block.append(chunk.constData() + i, DICTIONARY_ENTRY_SIZE);
+                }
+                pos += DICTIONARY_ENTRY_SIZE;
+            }
+            if(block.size() >= GAME_BLOCK_SIZE) {
+                ok = out->write(block) == block.size();
+                written += quint32(block.size());
+                block.resize(0);
+            }
+        }
+        in.close();
+    }
+    return ok && out->write(block) == block.size();
+}
+
+void chess::Database::fillIndexEntry(IndexEntry *ie, QMap<QString, QString> *headers) {
+    ie->round = headers->value("Round").toUInt();
+    ie->eloWhite = headers->value("WhiteElo").toUInt();
+    ie->eloBlack = headers->value("BlackElo").toUInt();
+    QString res = headers->value("Result");
+    if(res == "1-0") {
+        ie->result = RES_WHITE_WINS;
+    } else if(res == "0-1") {
+        ie->result = RES_BLACK_WINS;
+    } else if(res == "1/2-1/2") {
+        ie->result = RES_DRAW;
+    } else {
+        ie->result = RES_UNDEF;
+    }
+    memset(ie->eco, 0, sizeof ie->eco);
+    QByteArray eco = headers->value("ECO").toUtf8().left(3);
+    memcpy(ie->eco, eco.constData(), size_t(eco.size()));
+    // parse the date, parts that are missing or out of range are 0
+    ie->year = 0;
+    ie->month = 0;
+    ie->day = 0;
+    QStringList dd_mm_yy = headers->value("Date").split(".");
+    if(dd_mm_yy.size() > 0 && dd_mm_yy.at(0).length() == 4) {
+        quint16 prob_year = dd_mm_yy.at(0).toInt();
+        if(prob_year > 0 && prob_year < 2100) {
+            ie->year = prob_year;
+        }
+        if(dd_mm_yy.size() > 1 && dd_mm_yy.at(1).length() == 2) {
+            quint8 prob_month = dd_mm_yy.at(1).toInt();
+            if(prob_month > 0 && prob_month <= 12) {
+                ie->month = prob_month;
+            }
+            if(dd_mm_yy.size() > 2 && dd_mm_yy.at(2).length() == 2) {
+                quint8 prob_day = dd_mm_yy.at(2).toInt();
+                if(prob_day > 0 && prob_day < 32) {
+                    ie->day = prob_day;
+                }
+            }
+        }
+    }
+}
+
+quint32 chess::Database::dictionaryOffset(QMap<quint32, QString> *dict, QHash<QString, quint32> *reverse,
+                                          const QString &filename, const QByteArray &magic, const QString &value) {
+    if(value.isEmpty()) {
+        // as for games without the header
+        return 0;
+    }
+    // as stored: at most 36 bytes of utf-8, padded with blanks
+    QByteArray bytes = value.toUtf8().left(DICTIONARY_ENTRY_SIZE);
+    QString stored = QString::fromUtf8(bytes).trimmed();
+    if(reverse->isEmpty() && !dict->isEmpty()) {
+        // first lookup since loading. a value stored twice
+        // maps to its first offset, as with QMap::key()
+        QMapIterator<quint32, QString> i(*dict);
+        while(i.hasNext()) {
+            i.next();
+            if(!reverse->contains(i.value())) {
+                reverse->insert(i.value(), i.key());
+            }
+        }
+    }
+    QHash<QString, quint32>::const_iterator found = reverse->constFind(stored);
+    if(found != reverse->constEnd()) {
+        return found.value();
+    }
+    QFile file(filename);
+    if(!file.open(QFile::Append)) {
+        throw std::invalid_argument("can't append to dictionary file");
+    }
+    if(file.size() == 0) {
+        file.write(magic, magic.length());
+    }
+    while(bytes.size() < DICTIONARY_ENTRY_SIZE) {
+        bytes.append(char(0x20));
+    }
+    quint32 offset = quint32(file.size());
+    // synced, as the index entry that refers to it is written next
+    if(file.write(bytes, DICTIONARY_ENTRY_SIZE) != DICTIONARY_ENTRY_SIZE || !ImportJournal::sync(&file)) {
+        throw std::invalid_argument("can't append to dictionary file");
+    }
+    file.close();
+    dict->insert(offset, stored);
+    reverse->insert(stored, offset);
+    return offset;
+}
+
+bool chess::Database::finishCompact() {
+    QStringList files = this->databaseFiles();
+    if(!QFile::exists(this->filenameCompact)) {
+        // the new files may be incomplete, the old ones are still valid
+        for(int i=0;i<files.size();i++) {
+            QFile::remove(QString(files.at(i)).append(".new"));
+        }
+        return true;
+    }
+    // the new files are complete. a file without a new one
+    // left has been replaced before the interruption
+    bool ok = true;
+    for(int i=0;i<files.size() && ok;i++) {
+        QString replacement = QString(files.at(i)).append(".new");
+        if(QFile::exists(replacement)) {
+            // rename() doesn't overwrite
+            QFile::remove(files.at(i));
+            ok = QFile::rename(replacement, files.at(i));
+        }
+    }
+    if(!ok) {
+        std::cerr << "Error: can't replace database files by compacted ones." << std::endl;
+        return false;
+    }
+    QFile::remove(this->filenameCompact);
+    return true;
+}
+
+bool chess::Database::writeIndexEntry(int i, const QByteArray &bytes) {
+    QFile fnIndex(this->filenameIndex);
+    if(!fnIndex.open(QFile::ReadWrite)) {
+        return false;
+    }
+    qint64 pos = INDEX_HEADER_SIZE + qint64(i) * INDEX_ENTRY_SIZE;
+    bool ok = fnIndex.seek(pos) && fnIndex.write(bytes) == bytes.size()
+            && ImportJournal::sync(&fnIndex);
+    fnIndex.close();
+    return ok;
+}
+
+bool chess::Database::markDeleted(int i) {
+    if(i < 0 || i >= this->indices->size() || !this->checkNoPendingImport()) {
+        return false;
+    }
+    // only the status byte at the start of the entry
+    QByteArray status;
+    ByteUtil::append_as_uint8(&status, GAME_DELETED);
+    if(!this->writeIndexEntry(i, status)) {
+        return false;
+    }
+    this->indices->at(i)->deleted = true;
+    this->invalidateGame(i);
+    return true;
+}
+
+bool chess::Database::replaceGame(int i, Game *game) {
+    if(i < 0 || i >= this->indices->size() || !this->checkNoPendingImport()) {
+        return false;
+    }
+    IndexEntry *ie = this->indices->at(i);
+    IndexEntry entry;
+    entry.deleted = false;
+    try {
+        entry.whiteOffset = this->dictionaryOffset(this->offsetNames, this->nameOffsets, this->filenameNames,
+                                                   this->magicNameString, game->headers->value("White"));
+        entry.blackOffset = this->dictionaryOffset(this->offsetNames, this->nameOffsets, this->filenameNames,
+                                                   this->magicNameString, game->headers->value("Black"));
+        entry.siteRef = this->dictionaryOffset(this->offsetSites, this->siteOffsets, this->filenameSites,
+                                               this->magicSitesString, game->headers->value("Site"));
+        entry.eventRef = this->dictionaryOffset(this->offsetEvents, this->eventOffsets, this->filenameEvents,
+                                                this->magicEventString, game->headers->value("Event"));
+    } catch(std::invalid_argument a) {
+        std::cerr << a.what() << std::endl;
+        return false;
+    }
+    this->fillIndexEntry(&entry, game->headers);
+
+    // the new record goes to the end of the .dcg, the old one
+    // stays in place unused until the database is compacted
+    QByteArray record;
+    this->dcgencoder->encodeGame(game, &record);
+    QFile fnGames(this->filenameGames);
+    if(!fnGames.open(QFile::Append)) {
+        return false;
+    }
+    entry.gameOffset = quint64(fnGames.size());
+    bool ok = fnGames.write(record) == record.size() && ImportJournal::sync(&fnGames);
+    fnGames.close();
+    if(!ok) {
+        return false;
+    }
+    // the index entry is written in one go once the record is on
+    // disk, so it points either to the old or to the complete new record
+    QByteArray bytes;
+    entry.write(&bytes);
+    if(!this->writeIndexEntry(i, bytes)) {
+        return false;
+    }
+    ie->read(reinterpret_cast<const uint8_t*>(bytes.constData()));
+
+    // the mapping doesn't cover the appended record yet
+    this->unmapGames();
+    this->mapGames();
+    this->invalidateGame(i);
+    QMutexLocker lock(this->mutex);
+    if(!this->recordStarts->isEmpty()) {
+        // the old end of file is where the new record starts
+        this->recordStarts->append(entry.gameOffset + quint64(record.size()));
+    }
+    return true;
 }
 
 void chess::Database::importPgnNamesSitesEvents(QString &pgnfile,
@@ -583,17 +1366,18 @@ void chess::Database::importPgnAppendEvents(QMap<QString, quint32> *events) {
 }
 
 
-void chess::Database::importPgnAppendGamesIndices(QString &pgnfile,
+bool chess::Database::importPgnAppendGamesIndices(QString &pgnfile,
                                                   QMap<QString, quint32> *names,
                                                   QMap<QString, quint32> *sites,
-                                                  QMap<QString, quint32> *events) {
+                                                  QMap<QString, quint32> *events,
+                                                  ImportJournal *journal, quint64 offset) {
 
     // now save everything
     chess::HeaderOffset *header = new chess::HeaderOffset();
-    quint64 offset = 0;
     QFile pgnFile(pgnfile);
     quint64 size = pgnFile.size();
     bool stop = false;
+    bool ok = false;
 
     const char* encoding = this->pgnreader->detect_encoding(pgnfile);
 
@@ -615,7 +1399,17 @@ void chess::Database::importPgnAppendGamesIndices(QString &pgnfile,
             if(fnGames.pos() == 0) {
                 fnGames.write(magicGamesString, magicGamesString.length());
             }
+            // the starting point, also marks the names,
+            // sites and events as complete
+            ok = ImportJournal::sync(&fnGames) && ImportJournal::sync(&fnIndex)
+                    && journal->checkpoint(offset, quint64(fnIndex.pos()), quint64(fnGames.pos()));
+            stop = !ok;
             std::cout << "\nsaving games: 0/"<< size;
+            // encoded games are collected in one large block
+            // that is written out whenever it is full
+            QByteArray gameBlock;
+            gameBlock.reserve(GAME_BLOCK_SIZE + 65536);
+            quint64 gamesPos = fnGames.pos();
             int i = 0;
             while(!stop) {
                 if(i%100==0) {
@@ -627,116 +1421,43 @@ void chess::Database::importPgnAppendGamesIndices(QString &pgnfile,
                     stop = true;
                     continue;
                 }
-                // the current index entry
-                QByteArray iEntry;
-                // first write index entry
-                // status
-                ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
-                // game offset
-                ByteUtil::append_as_uint64(&iEntry, fnGames.pos());
-                // white offset
-                QString white = header->headers->value("White");
-                quint32 whiteOffset = names->value(white);
-                ByteUtil::append_as_uint32(&iEntry, whiteOffset);
-                // black offset
-                QString black = header->headers->value("Black");
-                quint32 blackOffset = names->value(black);
-                ByteUtil::append_as_uint32(&iEntry, blackOffset);
-                // round
-                quint16 round = header->headers->value("Round").toUInt();
-                ByteUtil::append_as_uint16(&iEntry, round);
-                // site offset
-                quint32 site_offset = sites->value(header->headers->value("Site"));
-                ByteUtil::append_as_uint32(&iEntry, site_offset);
-                // event offset
-                quint32 event_offset = events->value(header->headers->value("Event"));
-                ByteUtil::append_as_uint32(&iEntry, event_offset);
-                qDebug() << "EVENT OFFSET: " << event_offset;
-                // elo white
-                quint16 elo_white = header->headers->value("WhiteElo").toUInt();
-                qDebug() << "elo white: " << elo_white;
-                ByteUtil::append_as_uint16(&iEntry, elo_white);
-                quint16 elo_black = header->headers->value("BlackElo").toUInt();
-                ByteUtil::append_as_uint16(&iEntry, elo_black);
-                // result
-                if(header->headers->contains("Result")) {
-                    QString res = header->headers->value("Result");
-                    if(res == "1-0") {
-                        ByteUtil::append_as_uint8(&iEntry, quint8(0x01));
-                    } else if(res == "0-1") {
-                        ByteUtil::append_as_uint8(&iEntry, quint8(0x02));
-                    } else if(res == "1/2-1/2") {
-                        ByteUtil::append_as_uint8(&iEntry, quint8(0x03));
-                    } else {
-                        ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
-                    }
-                } else  {
-                    ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
-                }
-                qDebug() << iEntry.size();
-                // ECO
-                if(header->headers->contains("ECO")) {
-                    QByteArray eco = header->headers->value("ECO").toUtf8().left(3);
-                    qDebug() << eco;
-                    iEntry.append(eco);
-                } else {
-                    QByteArray eco = QByteArrayLiteral("\x00\x00\x00");
-                    iEntry.append(eco);
-                }
-                qDebug() << iEntry.size();
-                // parse date
-                if(header->headers->contains("Date")) {
-                    QString date = header->headers->value("Date");
-                    // try to parse the date
-                    quint16 year = 0;
-                    quint8 month = 0;
-                    quint8 day = 0;
-                    QStringList dd_mm_yy = date.split(".");
-                    if(dd_mm_yy.size() > 0 && dd_mm_yy.at(0).length() == 4) {
-                        quint16 prob_year = dd_mm_yy.at(0).toInt();
-                        qDebug() << "PROb YEAR:" << prob_year;
-                        if(prob_year > 0 && prob_year < 2100) {
-                            year = prob_year;
-                        }
-                        if(dd_mm_yy.size() > 1 && dd_mm_yy.at(1).length() == 2) {
-                            quint8 prob_month = dd_mm_yy.at(1).toInt();
-                            qDebug() << "prob monath: " << prob_month;
-                            if(prob_month > 0 && prob_month <= 12) {
-                                month = prob_month;
-                            }
-                            if(dd_mm_yy.size() > 2 && dd_mm_yy.at(2).length() == 2) {
-                            quint8 prob_day = dd_mm_yy.at(2).toInt();
-                            if(prob_day > 0 && prob_day < 32) {
-                                day = prob_day;
-                                }
-                            }
-                        }
-                    }
-                    qDebug() << "YEAR: " << year;
-                    ByteUtil::append_as_uint16(&iEntry, year);
-                    ByteUtil::append_as_uint8(&iEntry, month);
-                    ByteUtil::append_as_uint8(&iEntry, day);
-                } else {
-                    ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
-                    ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
-                    ByteUtil::append_as_uint8(&iEntry, quint8(0x00));
+                IndexEntry entry;
+                entry.deleted = false;
+                entry.gameOffset = gamesPos + gameBlock.size();
+                entry.whiteOffset = names->value(header->headers->value("White"));
+                entry.blackOffset = names->value(header->headers->value("Black"));
+                entry.siteRef = sites->value(header->headers->value("Site"));
+                entry.eventRef = events->value(header->headers->value("Event"));
+                this->fillIndexEntry(&entry, header->headers);
+                // convert the game directly into the output block
+                pgntranscoder->transcodeGameFromFile(pgnfile, encoding, header->offset, &gameBlock);
+                // games without ECO tag get the code of their main line
+                const EcoEntry *eco = pgntranscoder->getEcoEntry();
+                if(entry.eco[0] == 0 && eco != 0) {
+                    memcpy(entry.eco, eco->code, 3);
                 }
-                qDebug() << iEntry.size();
-                assert(iEntry.size() == 39);
+                QByteArray iEntry;
+                entry.write(&iEntry);
+                assert(iEntry.size() == INDEX_ENTRY_SIZE);
                 fnIndex.write(iEntry, iEntry.length());
-                //qDebug() << "just before reading back file";
-                chess::Game *g = pgnreader->readGameFromFile(pgnfile, encoding, header->offset);
-                //qDebug() << "READ file ok";
-                QByteArray *g_enc = dcgencoder->encodeGame(g); //"<<<<<<<<<<<<<<<<<<<<<< this is the cause of mem acc fault"
-                //qDebug() << "enc ok";
-                qDebug() << "writing game: " << g_enc->toHex();
-                fnGames.write(*g_enc, g_enc->length());
-                delete g_enc;
+                if(gameBlock.size() >= GAME_BLOCK_SIZE || i % IMPORT_COMMIT_GAMES == 0) {
+                    // group commit: first the games, then the index
+                    // entries that refer to them, then the checkpoint
+                    fnGames.write(gameBlock, gameBlock.length());
+                    gamesPos += gameBlock.size();
+                    gameBlock.resize(0);
+                    ok = ImportJournal::sync(&fnGames) && ImportJournal::sync(&fnIndex)
+                            && journal->checkpoint(offset, quint64(fnIndex.pos()), gamesPos);
+                    stop = !ok;
+                }
                 header->headers->clear();
                 if(header->headers!=0) {
                     delete header->headers;
                 }
-                delete g;
+            }
+            if(ok) {
+                fnGames.write(gameBlock, gameBlock.length());
+                ok = ImportJournal::sync(&fnGames) && ImportJournal::sync(&fnIndex);
             }
             std::cout << "\rsaving games: "<<size<< "/"<<size << std::endl;
         }
@@ -744,6 +1465,7 @@ void chess::Database::importPgnAppendGamesIndices(QString &pgnfile,
     }
     fnIndex.close();
     delete header;
+    return ok;
 }
 
 
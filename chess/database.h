@@ -2,31 +2,122 @@
 #define DATABASE_H
 
 #include <QString>
+#include <QFile>
+#include <QCache>
+#include <QMutex>
+#include <QVector>
+#include <QSet>
+#include <QHash>
 #include "chess/pgn_reader.h"
+#include "chess/pgn_transcoder.h"
 #include "chess/dcgencoder.h"
 #include "chess/dcgdecoder.h"
 #include "chess/indexentry.h"
 #include "chess/game.h"
+#include "chess/flat_game.h"
+#include "chess/importjournal.h"
 
 namespace chess {
 
 const quint8 GAME_DELETED = 0xFF;
 const quint8 GAME_NOT_DELETED = 0x00;
+// magic (10 bytes), version (1 byte) and the game to load upon open (8 bytes)
+const int INDEX_HEADER_SIZE = 19;
+// size of the block of encoded games that is collected
+// before writing to the .dcg file during import
+const int GAME_BLOCK_SIZE = 1 << 20;
+// an import makes its games durable and records a checkpoint in the
+// journal after this many games (or earlier, when a block is full)
+const int IMPORT_COMMIT_GAMES = 1000;
 
+// after loadIndex() and the other load*() calls, the index, the name,
+// site and event dictionaries and the mapping of the .dcg file are only
+// read. hence any number of threads may call getGameAt(), getFlatGameAt()
+// and readHeaders() concurrently on one database; scratch state for
+// decoding is taken from a pool per call. loading, importing and saving
+// must not run concurrently with readers
 class Database
 {
 public:
     Database(QString &filename);
     ~Database();
 
+    // appends the games of pgnfile. progress is recorded in a journal
+    // (*.dcj), cf. ImportJournal. if an import of the same file was
+    // interrupted, it continues after the last checkpoint
     void importPgnAndSave(QString &pgnfile);
+    // rewrites the database without the games marked as deleted. the
+    // .dci and .dcg files are streamed once and live records are copied
+    // as they are; names, sites and events that no game refers to any
+    // more are dropped. each file is written next to the old one
+    // (*.new) and synced. only then a marker (*.dcx) is created, and the
+    // new files are renamed over the old ones. if this is interrupted,
+    // the next loadIndex() or import completes the renaming if the
+    // marker exists, and otherwise removes the new files. positions of
+    // games change, hence index and dictionaries are reloaded. returns
+    // false if a file can't be read or written; nothing is replaced then
+    bool compact();
+    // true if an interrupted import left its journal to be resumed. the
+    // journal records the lengths of .dci and .dcg, so compact(),
+    // markDeleted() and replaceGame() refuse to write until the import
+    // has been completed by importPgnAndSave()
+    bool hasPendingImport();
+    // edits in place: markDeleted() only sets the status byte of entry
+    // i in the .dci. replaceGame() appends the encoded game to the .dcg
+    // and any new names, sites and events to their files, then rewrites
+    // entry i (taken from the headers of game) in place. the old record
+    // is left unreferenced until compact(). names, sites and events must
+    // have been loaded. returns false if a file can't be written
+    bool markDeleted(int i);
+    bool replaceGame(int i, chess::Game *game);
     void saveToFile();
+    // first completes an interrupted compact() and rolls back the files of
+    // an interrupted import to its last checkpoint. no other process may
+    // import into the database meanwhile
     void loadIndex();
     void loadSites();
     void loadNames();
     void loadEvents();
     chess::Game* getGameAt(int i);
+    // games returned by getGameAt() store a board only every plies
+    // plies, cf. Game::setBoardCheckpoints(). 0 (default) for all nodes
+    void setBoardCheckpoints(int plies);
+    // decodes game i into g, or copies it from the game cache. the
+    // copy is cheap since the ply array and side tables are shared
+    // until modified. safe to call from several threads at once
+    chess::FlatGame* getFlatGameAt(int i, chess::FlatGame *g);
+    // fetch many games at once, i.e. the result of a search. the records
+    // are read in the order of their position in the .dcg file, records
+    // close to each other with a single read, and are decoded on a pool
+    // of threads. games are returned in the order of ids, with 0 for ids
+    // out of range or records that can't be decoded. the caller owns the
+    // list and the games. the game cache is not used
+    QList<chess::Game*>* getGamesAt(const QList<int> &ids);
+    QList<chess::FlatGame*>* getFlatGamesAt(const QList<int> &ids);
+    // number of threads used by getGamesAt() and getFlatGamesAt(),
+    // the number of cores by default
+    void setBatchThreads(int n);
+    // keep up to bytes of games decoded by getFlatGameAt() in memory,
+    // least recently used ones are dropped first. 0 (default) disables
+    // the cache
+    void setGameCacheSize(int bytes);
+    // drop game i from the cache, i.e. after it was replaced or deleted
+    void invalidateGame(int i);
+    void clearGameCache();
+    int getCacheHits();
+    int getCacheMisses();
     int countGames();
+    chess::IndexEntry* getIndexEntry(int i);
+    QString getIndexFilename();
+    QString getGamesFilename();
+    // resolve the references of an index entry, the
+    // respective load*() must have been called before
+    QString getName(quint32 offset);
+    QString getSite(quint32 offset);
+    QString getEvent(quint32 offset);
+    // inserts the headers stored in the index entry (players, site,
+    // event, date, result, eco, round, elos) and returns the result
+    int readHeaders(IndexEntry *ie, QMap<QString, QString> *headers);
 
 
 private:
@@ -35,6 +126,8 @@ private:
     QString filenameNames;
     QString filenameSites;
     QString filenameEvents;
+    QString filenameJournal;
+    QString filenameCompact;
     QString filenameIndex;
     QString filenameGames;
     QByteArray magicNameString;
@@ -46,6 +139,11 @@ private:
     QMap<quint32, QString> *offsetNames;
     QMap<quint32, QString> *offsetSites;
     QMap<quint32, QString> *offsetEvents;
+    // the reverse of the above, for dictionaryOffset(). built on its
+    // first use after the respective load*(), which clears it
+    QHash<QString, quint32> *nameOffsets;
+    QHash<QString, quint32> *siteOffsets;
+    QHash<QString, quint32> *eventOffsets;
     QList<chess::IndexEntry*> *indices;
     void writeSites();
     void writeNames();
@@ -59,17 +157,76 @@ private:
     void importPgnAppendNames(QMap<QString, quint32> *names);
     void importPgnAppendSites(QMap<QString, quint32> *sites);
     void importPgnAppendEvents(QMap<QString, quint32> *events);
-    void importPgnAppendGamesIndices(QString &pgnfile,
+    // appends the games from offset in pgnfile on,
+    // with a checkpoint in journal after each commit
+    bool importPgnAppendGamesIndices(QString &pgnfile,
                                      QMap<QString, quint32> *names,
                                      QMap<QString, quint32> *sites,
-                                     QMap<QString, quint32> *events);
+                                     QMap<QString, quint32> *events,
+                                     ImportJournal *journal, quint64 offset);
+    // name, site, event, index and games file, as recorded in the journal
+    QStringList databaseFiles();
+    // rolls back an interrupted import. returns true if
+    // it can be resumed, i.e. reached a checkpoint
+    bool recoverImport(ImportJournal *journal);
+    // prints an error and returns false if hasPendingImport()
+    bool checkNoPendingImport();
+
+    // copies the entries of a name, site or event file that are in used
+    // to out, and records their new positions in offsets
+    bool compactDictionary(const QString &filename, const QByteArray &magic, QSet<quint32> *used,
+                           QHash<quint32, quint32> *offsets, QFile *out);
+    // replaces the database files by the *.new files of a compact() if
+    // its marker exists, else removes them. returns false if a file
+    // can't be renamed; the marker stays then
+    bool finishCompact();
+
+    // sets all fields of an index entry that are taken directly from
+    // the headers, i.e. all but the offsets and the status
+    void fillIndexEntry(IndexEntry *ie, QMap<QString, QString> *headers);
+    // offset of value in a name, site or event file. appends it to the
+    // file, dict and its reverse if it's not there yet
+    quint32 dictionaryOffset(QMap<quint32, QString> *dict, QHash<QString, quint32> *reverse,
+                             const QString &filename, const QByteArray &magic, const QString &value);
+    // overwrites the start of index entry i with bytes and syncs the .dci
+    bool writeIndexEntry(int i, const QByteArray &bytes);
 
     int decodeLength(QDataStream *stream);
+    // persistent read-only mapping of the .dcg file; games are
+    // decoded directly from it. mapped by loadIndex() and
+    // released before anything is appended to the file
+    QFile *gamesFile;
+    uchar *gamesMap;
+    qint64 gamesMapSize;
+    bool mapGames();
+    void unmapGames();
+    // returns the record of the game (after the length), either in the
+    // mapped file or read into buffer. 0 if it can't be read
+    const uint8_t* gameRecord(IndexEntry *ie, DcgDecoder *decoder, size_t *length, QByteArray *buffer);
+    // start of each record in the .dcg file in ascending order, followed
+    // by the size of the file. gives the end of a record without reading
+    // its length. built on the first batch fetch after loadIndex()
+    QVector<quint64> *recordStarts;
+    quint64 recordEnd(quint64 offset);
+    int batchThreads;
+    // reads and decodes ids into either games or flatGames
+    void fetchBatch(const QList<int> &ids, QVector<chess::Game*> *games, QVector<chess::FlatGame*> *flatGames);
+    // guards the game cache, the decoder pool and recordStarts
+    QMutex *mutex;
+    QCache<int, chess::FlatGame> *gameCache;
+    int cacheHits;
+    int cacheMisses;
+    // decoders (with their scratch board) not in use by any thread.
+    // each lookup takes one and puts it back afterwards
+    QList<chess::DcgDecoder*> *decoders;
+    chess::DcgDecoder* acquireDecoder();
+    void releaseDecoder(chess::DcgDecoder *decoder);
     chess::DcgEncoder *dcgencoder;
-    chess::DcgDecoder *dcgdecoder;
     chess::PgnReader *pgnreader;
+    chess::PgnTranscoder *pgntranscoder;
 
     quint64 loadUponOpen;
+    int boardCheckpoints;
 };
 
 }
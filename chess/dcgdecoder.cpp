@@ -1,5 +1,4 @@
 #include "dcgdecoder.h"
-#include <QDebug>
 #include <QStack>
 #include <iostream>
 
@@ -7,96 +6,138 @@
 chess::DcgDecoder::DcgDecoder()
 {
     //this->game = new chess::Game();
+    this->board = new chess::Board();
 }
 
 chess::DcgDecoder::~DcgDecoder()
 {
     //this->game = new chess::Game();
+    delete this->board;
 }
 
 
 int chess::DcgDecoder::decodeLength(QByteArray *ba, int *index) {
-    int idx = *index;
-    quint8 len1 = ba->at(idx);
-    qDebug() << "len1 is: " << len1;
+    size_t idx = size_t(*index);
+    // at most the size of ba, so it fits
+    int len = int(this->decodeLength(reinterpret_cast<const uint8_t*>(ba->constData()), size_t(ba->size()), &idx));
+    *index = int(idx);
+    return len;
+}
+
+size_t chess::DcgDecoder::decodeLength(const uint8_t *data, size_t size, size_t *index) {
+    size_t len = this->decodeLengthField(data, size, index);
+    // *index <= size here, so this can't wrap
+    if(len > size - *index) {
+        throw std::invalid_argument("length exceeds end of data");
+    }
+    return len;
+}
+
+size_t chess::DcgDecoder::decodeLengthField(const uint8_t *data, size_t size, size_t *index) {
+    size_t idx = *index;
+    if(idx >= size) {
+        throw std::invalid_argument("length decoding called beyond end of data");
+    }
+    quint8 len1 = data[idx];
     if(len1 < 127) {
-        qDebug() << "case 0: " << len1;
         (*index)++;
-        return int(len1);
-    }
-    if(len1 == 0x81) {        
-        quint8 len2 = ba->at(idx+1);
-        qDebug() << "LEN2, case 1: " << len2;
-        *index += 2;
-        return int(len2);
-    }
-    if(len1 == 0x82) {
-        quint16 len2 = quint8(ba->at(idx+1))*256 + quint8(ba->at(idx+2));
-        *index+=3;
-        return int(len2);
-    }
-    if(len1 == 0x83) {
-        quint32 ret = quint8(ba->at(idx+1)) * 256 * 256 + quint8(ba->at(idx+2)) * 256 + quint8(ba->at(idx+3));
-        *index+=4;
-        return ret;
-    }
-    if(len1 == 0x84) {
-        quint32 ret = quint8(ba->at(idx+1)) * 256*256*256 + quint8(ba->at(idx+2)) * 256 * 256
-                + quint8(ba->at(idx+3)) * 256 + quint8(ba->at(idx+4));
-        *index+=5;
-        return int(ret);
-    }
-    qDebug() << "error here: " << ba->mid(*index, 30).toHex();
-    throw std::invalid_argument("length decoding called with illegal byte value");
+        return size_t(len1);
+    }
+    // number of bytes that follow the length marker
+    size_t n = 0;
+    if(len1 >= 0x81 && len1 <= 0x84) {
+        n = len1 - 0x80;
+    } else {
+        throw std::invalid_argument("length decoding called with illegal byte value");
+    }
+    if(idx + n >= size) {
+        throw std::invalid_argument("length decoding called beyond end of data");
+    }
+    quint32 ret = 0;
+    for(size_t i=1;i<=n;i++) {
+        ret = (ret << 8) + data[idx+i];
+    }
+    *index += n + 1;
+    return size_t(ret);
 }
 
-void chess::DcgDecoder::decodeAnnotations(QByteArray *ba, int *idx, int len, GameNode *current) {
-    int start = *idx;
-    int stop = (*idx) + len;
-    for(int i=start;i<stop;i++) {
-        quint8 ann_i = ba->at(i);
-        qDebug() << "decoding annotation byte: " << ann_i;
-        current->addNag(int(ann_i));
-        (*idx)++;
+chess::GameNode* chess::DcgDecoder::appendPly(Game *g, GameNode *current, const Move &m) {
+    this->board->make(m);
+    GameNode *next = g->createNode();
+    next->setMove(g->createMove(m));
+    next->setParent(current);
+    current->addVariation(next);
+    if(this->board->make_depth() % g->getBoardCheckpoints() == 0) {
+        // replays the moves from the previous checkpoint
+        next->getBoard();
     }
+    return next;
 }
 
 chess::Game* chess::DcgDecoder::decodeGame(Game *g, QByteArray *ba) {
+    return this->decodeGame(g, reinterpret_cast<const uint8_t*>(ba->constData()), size_t(ba->size()));
+}
+
+chess::Game* chess::DcgDecoder::decodeGame(Game *g, const uint8_t *data, size_t size, bool withComments) {
     // to remember variations
-    qDebug() << "called decode game with: " << ba->toHex();
-    QStack<GameNode*> *game_stack = new QStack<GameNode*>();
-    game_stack->push(g->getRootNode());
+    QStack<GameNode*> game_stack;
+    game_stack.push(g->getRootNode());
     GameNode* current = g->getRootNode();
-    int idx = 0;
+    size_t idx = 0;
     bool error = false;
+    if(size == 0) {
+        return g;
+    }
     // first check if we have a fen marker
-    quint8 fenmarker = ba->at(idx);
+    quint8 fenmarker = data[idx];
     if(fenmarker == 0x01) {
         idx++;
-        int len = this->decodeLength(ba, &idx);
-        QByteArray fen = ba->mid(idx, len);
-        QString fen_string = QString::fromUtf8(fen);
-        chess::Board *b = new chess::Board(fen_string);
-        g->getCurrentNode()->setBoard(b);
-        idx += len;
+        try {
+            size_t len = this->decodeLength(data, size, &idx);
+            chess::Board *b = new chess::Board(reinterpret_cast<const char*>(data + idx), int(len));
+            if(g->getArena() != 0) {
+                g->getArena()->adopt(b);
+            }
+            g->getCurrentNode()->setBoard(b);
+            idx += len;
+        } catch(std::invalid_argument a) {
+            std::cerr << a.what() << std::endl;
+            error = true;
+        }
     } else if(fenmarker == 0x00) {
         idx++;
     } else {
         error = true;
         idx++;
     }
-    while(idx < ba->length() && !error) {
-        quint8 byte = ba->at(idx);
-        qDebug() << "next byte: " << byte;
+    // with checkpoints, moves are checked and applied on one board
+    // that follows the decoded line, and only every checkpoints-th
+    // node gets a board of its own
+    int checkpoints = g->getBoardCheckpoints();
+    if(checkpoints > 0) {
+        BoardState root;
+        g->getRootNode()->getBoard()->save_state(&root);
+        this->board->restore_state(root);
+        this->varMoves.clear();
+        this->varDepths.clear();
+    }
+    while(idx < size && !error) {
+        quint8 byte = data[idx];
         // >= 0x84: we have a marker, not a move
         if(byte >= 0x84) {
             if(byte == 0x84) {
                 // start of variation
                 // put current node on stack so that we
                 // can go back when we reach end of variation
-                qDebug() << "var start";
-                game_stack->push(current);
+                game_stack.push(current);
                 current = current->getParent();
+                if(current == 0) {
+                    // variation before first move
+                    error = true;
+                } else if(checkpoints > 0) {
+                    this->varMoves.append(this->board->unmake());
+                    this->varDepths.append(this->board->make_depth());
+                }
                 idx++;
             }
             else if(byte == 0x85) {
@@ -105,53 +146,57 @@ chess::Game* chess::DcgDecoder::decodeGame(Game *g, QByteArray *ba) {
                 // one node, otherwise game is malformated (when closing
                 // variation we must have started one before)
                 // so pop from stack (but always leave root)
-                qDebug() << "end of variation, popping from stack @";
-                qDebug() << ba->mid(idx, 20).toHex();
-                if(game_stack->size() > 1) {
-                    current = game_stack->pop();
+                if(game_stack.size() > 1) {
+                    current = game_stack.pop();
+                    if(checkpoints > 0) {
+                        int depth = this->varDepths.takeLast();
+                        while(this->board->make_depth() > depth) {
+                            this->board->unmake();
+                        }
+                        this->board->make(this->varMoves.takeLast());
+                    }
                 }
                 idx++;
             }
-            else if(byte == 0x86) {
+            else if(byte == 0x86 || byte == 0x87) {
                 idx++;
-                // start of comment
-                qDebug() << "comment start, trying to get len";
-                int len = this->decodeLength(ba, &idx);
-                qDebug() << ba->mid(idx, len+2).toHex();
-                QString comment = QString::fromUtf8(QByteArray(ba->mid(idx,len)));
-                current->setComment(comment);
-                qDebug () << "got comment";
+                // start of comment (0x86) or annotations (0x87)
+                size_t len = 0;
+                try {
+                    len = this->decodeLength(data, size, &idx);
+                } catch(std::invalid_argument a) {
+                    std::cerr << a.what() << std::endl;
+                    error = true;
+                    break;
+                }
+                if(byte == 0x86) {
+                    if(withComments) {
+                        QString comment = QString::fromUtf8(reinterpret_cast<const char*>(data + idx), int(len));
+                        current->setComment(comment);
+                    }
+                } else {
+                    for(size_t i=0;i<len;i++) {
+                        current->addNag(int(data[idx+i]));
+                    }
+                }
                 idx+=len;
-            }
-            else if(byte == 0x87) {
-                idx++;
-                // annotations follow
-                qDebug() << "ANNOTATIONS follow...";
-                qDebug() << ba->mid(idx, 10).toHex();
-                int len = this->decodeLength(ba, &idx);
-                qDebug() << "len is: " << len;
-                this->decodeAnnotations(ba, &idx, len, current);
-                //idx+=len;
             } else if(byte == 0x88) {
                 // null move
-                Move *m = new Move();
-                GameNode *next = new GameNode();
-                Board *b_next = 0;
+                Move m;
                 try {
-                    Board *b = current->getBoard();
-                    b_next = b->copy_and_apply(*m);
-                    next->setMove(m);
-                    next->setBoard(b_next);
-                    next->setParent(current);
-                    current->addVariation(next);
-                    current = next;
+                    if(checkpoints > 0) {
+                        current = this->appendPly(g, current, m);
+                    } else {
+                        Board *b_next = g->createBoard(current->getBoard(), m);
+                        GameNode *next = g->createNode();
+                        next->setBoard(b_next);
+                        next->setMove(g->createMove(m));
+                        next->setParent(current);
+                        current->addVariation(next);
+                        current = next;
+                    }
                 } catch(std::invalid_argument a) {
                     std::cerr << a.what() << std::endl;
-                    delete m;
-                    delete next;
-                    if(b_next != 0) {
-                        delete b_next;
-                    }
                     error = true;
                 }
                 idx++;
@@ -161,11 +206,10 @@ chess::Game* chess::DcgDecoder::decodeGame(Game *g, QByteArray *ba) {
         } else {
             // we have a move, decode next two bytes
             // there should be at least one more move
-            if(idx+1 >= ba->size()) {
+            if(idx+1 >= size) {
                 error = true;
             } else {
-                qDebug() << "move dec";
-                quint16 move = byte*256 + quint8((ba->at(idx+1)));
+                quint16 move = byte*256 + data[idx+1];
                 quint8 from = quint8(quint16(move << 4) >> 10);
                 quint8 to = quint8((quint8(move) << 2)) >> 2;
                 // ((from % 8) + 1) is x column, (from/8) + 2 is row, cf.
@@ -174,45 +218,25 @@ chess::Game* chess::DcgDecoder::decodeGame(Game *g, QByteArray *ba) {
                 quint8 from_internal = ((from % 8) + 1) + (((from / 8) + 2) * 10);
                 quint8 to_internal = ((to % 8) + 1) + (((to / 8) + 2) * 10);
                 quint8 promotion_piece = quint8((move << 1) >> 13);
-                if(promotion_piece != 0) {
-                    qDebug() << "FROM: " << (move << 4);
-                    qDebug() << "TO: " << to;
-                    qDebug() << "PROM PIECE: " << promotion_piece;
-                    qDebug() << (chess::ROOK == 4);
-                    qDebug() << chess::ROOK;
-                }
-                Move *m = new Move();
-                GameNode *next = new GameNode();
-                Board *b_next = 0;
+                Move m = promotion_piece != 0 ?
+                            Move(from_internal, to_internal, promotion_piece) :
+                            Move(from_internal, to_internal);
                 try {
-                    Board *b = current->getBoard();
-                    if(promotion_piece != 0) {
-                        m = new chess::Move(from_internal, to_internal, promotion_piece);
-                        qDebug() << ba->mid(idx-1, 3).toHex();
-                        qDebug() << move;
-                        qDebug() << m->uci();
-                    } else {
-                        m = new chess::Move(from_internal, to_internal);
-                        qDebug() << m->uci();
-                    }
-                    if(b->is_legal_move(*m)) {
-                        b_next = b->copy_and_apply(*m);
-                        next->setMove(m);
+                    if(checkpoints > 0 && this->board->is_legal_move(m)) {
+                        current = this->appendPly(g, current, m);
+                    } else if(checkpoints <= 0 && current->getBoard()->is_legal_move(m)) {
+                        Board *b_next = g->createBoard(current->getBoard(), m);
+                        GameNode *next = g->createNode();
                         next->setBoard(b_next);
+                        next->setMove(g->createMove(m));
                         next->setParent(current);
                         current->addVariation(next);
                         current = next;
                     } else {
-                        qDebug() << "illegal move";
                         error = true;
                     }
                 } catch(std::invalid_argument a) {
                     std::cerr << a.what() << std::endl;
-                    delete m;
-                    delete next;
-                    if(b_next != 0) {
-                        delete b_next;
-                    }
                     error = true;
                 }
                 idx+=2;
@@ -221,3 +245,144 @@ chess::Game* chess::DcgDecoder::decodeGame(Game *g, QByteArray *ba) {
     }
     return g;
 }
+
+int chess::DcgDecoder::decodeMainline(const uint8_t *data, size_t size, QVector<quint16> *moves, int maxMoves) {
+    int start = moves->size();
+    if(size == 0 || maxMoves == 0) {
+        return 0;
+    }
+    size_t idx = 1;
+    if(data[0] == 0x01) {
+        size_t len = this->decodeLength(data, size, &idx);
+        idx += len;
+    } else if(data[0] != 0x00) {
+        return 0;
+    }
+    // nesting level of variations; moves are only taken at level 0
+    int depth = 0;
+    while(idx < size) {
+        quint8 byte = data[idx];
+        if(byte == 0x84) {
+            depth++;
+            idx++;
+        } else if(byte == 0x85) {
+            if(depth > 0) {
+                depth--;
+            }
+            idx++;
+        } else if(byte == 0x86 || byte == 0x87) {
+            // skip the content, it may contain marker bytes
+            idx++;
+            size_t len = this->decodeLength(data, size, &idx);
+            idx += len;
+        } else if(byte == 0x88) {
+            if(depth == 0) {
+                moves->append(FLAT_NULL_MOVE);
+            }
+            idx++;
+        } else if(byte > 0x88 || idx + 1 >= size) {
+            break;
+        } else {
+            if(depth == 0) {
+                moves->append(quint16(byte*256 + data[idx+1]));
+            }
+            idx += 2;
+        }
+        if(moves->size() - start == maxMoves) {
+            break;
+        }
+    }
+    return moves->size() - start;
+}
+
+QByteArray chess::DcgDecoder::decodeFen(const uint8_t *data, size_t size) {
+    if(size == 0 || data[0] != 0x01) {
+        return QByteArray();
+    }
+    size_t idx = 1;
+    size_t len = this->decodeLength(data, size, &idx);
+    return QByteArray(reinterpret_cast<const char*>(data + idx), int(len));
+}
+
+chess::FlatGame* chess::DcgDecoder::decodeGame(FlatGame *g, const uint8_t *data, size_t size, bool withComments) {
+    g->clear();
+    // to remember variations
+    QStack<int> game_stack;
+    game_stack.push(0);
+    int current = 0;
+    size_t idx = 0;
+    bool error = false;
+    if(size == 0) {
+        return g;
+    }
+    quint8 fenmarker = data[idx];
+    if(fenmarker == 0x01) {
+        idx++;
+        try {
+            size_t len = this->decodeLength(data, size, &idx);
+            g->setRootBoard(new chess::Board(reinterpret_cast<const char*>(data + idx), int(len)));
+            idx += len;
+        } catch(std::invalid_argument a) {
+            std::cerr << a.what() << std::endl;
+            error = true;
+        }
+    } else if(fenmarker == 0x00) {
+        idx++;
+    } else {
+        error = true;
+        idx++;
+    }
+    while(idx < size && !error) {
+        quint8 byte = data[idx];
+        if(byte >= 0x84) {
+            if(byte == 0x84) {
+                // start of variation, continues from the parent of current
+                game_stack.push(current);
+                current = g->getParent(current);
+                if(current < 0) {
+                    error = true;
+                }
+                idx++;
+            } else if(byte == 0x85) {
+                // end of variation, but always leave root
+                if(game_stack.size() > 1) {
+                    current = game_stack.pop();
+                }
+                idx++;
+            } else if(byte == 0x86 || byte == 0x87) {
+                idx++;
+                size_t len = 0;
+                try {
+                    len = this->decodeLength(data, size, &idx);
+                } catch(std::invalid_argument a) {
+                    std::cerr << a.what() << std::endl;
+                    error = true;
+                    break;
+                }
+                if(byte == 0x86) {
+                    if(withComments) {
+                        g->setComment(current, QString::fromUtf8(reinterpret_cast<const char*>(data + idx), int(len)));
+                    }
+                } else {
+                    for(size_t i=0;i<len;i++) {
+                        g->addNag(current, int(data[idx+i]));
+                    }
+                }
+                idx+=len;
+            } else if(byte == 0x88) {
+                current = g->addPly(current, FLAT_NULL_MOVE);
+                idx++;
+            } else {
+                error = true;
+            }
+        } else {
+            if(idx+1 >= size) {
+                error = true;
+            } else {
+                current = g->addPly(current, quint16(byte*256 + data[idx+1]));
+                idx+=2;
+            }
+        }
+    }
+    return g;
+}
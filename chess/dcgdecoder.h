@@ -2,10 +2,16 @@
 #define DCGDECODER_H
 
 #include "chess/game.h"
+#include "chess/flat_game.h"
 #include <QByteArray>
+#include <QVector>
+#include <stdint.h>
+#include <stddef.h>
 
 namespace chess {
 
+// not to be shared between threads; there is no state shared between
+// instances, so create one per thread (which is cheap)
 class DcgDecoder
 {
 public:
@@ -14,9 +20,44 @@ public:
     Game* decodeGame(Game *g, QByteArray *ba);
     int decodeLength(QByteArray *ba, int *idx);
 
+    // decode directly from a span of bytes (i.e. a region of a
+    // memory-mapped .dcg file) without copying the record first.
+    // data must point to the first byte after the length prefix
+    // of the game. comment text is only copied out if withComments is set,
+    // otherwise comment markers are skipped
+    Game* decodeGame(Game *g, const uint8_t *data, size_t size, bool withComments = true);
+    // decode a BER-encoded length at data[*idx], advance *idx past it.
+    // throws std::invalid_argument on illegal values, or if the length
+    // itself or the data it announces runs beyond size
+    size_t decodeLength(const uint8_t *data, size_t size, size_t *idx);
+    // same, but only the length itself must be within size, not the
+    // data it announces. for the length prefix of a record of which
+    // only the start has been read yet
+    size_t decodeLengthField(const uint8_t *data, size_t size, size_t *idx);
+    // decode into a game in flat representation. g is cleared first,
+    // headers are left to the caller. no board is needed per ply, hence
+    // moves are taken as stored and not checked for legality
+    FlatGame* decodeGame(FlatGame *g, const uint8_t *data, size_t size, bool withComments = true);
+    // appends only the main line moves of a record (in .dcg encoding,
+    // FLAT_NULL_MOVE for null moves) to moves. variations, comments and
+    // nags are skipped, moves are not checked for legality. stops after
+    // maxMoves moves unless it is negative. returns the number of moves
+    // appended. throws std::invalid_argument if a length is malformed
+    int decodeMainline(const uint8_t *data, size_t size, QVector<quint16> *moves, int maxMoves = -1);
+    // FEN of the position a record starts from, empty for the initial
+    // position. throws std::invalid_argument if it is malformed
+    QByteArray decodeFen(const uint8_t *data, size_t size);
+
 private:
     Game* game;
-    void decodeAnnotations(QByteArray *ba, int *idx, int len, GameNode *current);
+    // used instead of a board per node if the game
+    // has board checkpoints, cf. Game::setBoardCheckpoints()
+    Board *board;
+    // moves unmade on board where a variation was started, and
+    // the number of moves made on it at that point
+    QVector<Move> varMoves;
+    QVector<int> varDepths;
+    GameNode* appendPly(Game *g, GameNode *current, const Move &m);
 };
 
 }
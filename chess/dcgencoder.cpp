@@ -1,6 +1,6 @@
 #include "dcgencoder.h"
 #include "assert.h"
-#include <QDebug>
+#include <string.h>
 #include "chess/byteutil.h"
 
 namespace chess {
@@ -10,12 +10,14 @@ namespace chess {
 
 DcgEncoder::DcgEncoder()
 {
-    this->gameBytes = new QByteArray();
+    this->gameBytes = 0;
+    this->lengthHint = 2;
+    this->recordStart = 0;
+    this->lengthReserved = 0;
 }
 
 DcgEncoder::~DcgEncoder()
 {
-    delete this->gameBytes;
 }
 
 void DcgEncoder::traverseNodes(GameNode *current) {
@@ -65,34 +67,131 @@ void DcgEncoder::traverseNodes(GameNode *current) {
     }
 }
 
+void DcgEncoder::traversePlies(FlatGame *game, int ply) {
+    // same order as traverseNodes(), but the main line
+    // is followed in a loop instead of a recursive call
+    int main = game->getFirstChild(ply);
+    while(main >= 0) {
+        this->appendMove(game->getMoveCode(main));
+        const QList<int> *nags = game->getNags(main);
+        if(nags != 0) {
+            this->appendNags(nags);
+        }
+        if(game->hasComment(main)) {
+            this->appendComment(game->getComment(main));
+        }
+        for(int var_i = game->getNextSibling(main); var_i >= 0; var_i = game->getNextSibling(var_i)) {
+            this->appendStartTag();
+            this->appendMove(game->getMoveCode(var_i));
+            nags = game->getNags(var_i);
+            if(nags != 0) {
+                this->appendNags(nags);
+            }
+            if(game->hasComment(var_i)) {
+                this->appendComment(game->getComment(var_i));
+            }
+            this->traversePlies(game, var_i);
+            this->appendEndTag();
+        }
+        main = game->getFirstChild(main);
+    }
+}
+
 QByteArray* DcgEncoder::encodeGame(Game *game) {
-    //qDebug() << "encoding";
-    delete this->gameBytes;
-    //qDebug() << "deleted gamebytes";
-    this->gameBytes = new QByteArray();
+    QByteArray *ba = new QByteArray();
+    ba->reserve(256);
+    this->encodeGame(game, ba);
+    return ba;
+}
+
+int DcgEncoder::encodeGame(Game *game, QByteArray *out) {
+    this->beginGame(out, game->getRootNode()->getBoard());
+    // if the root node has a comment, append first
+    if(!(game->getRootNode()->getComment().isEmpty())) {
+        this->appendComment(game->getRootNode());
+    }
+    this->traverseNodes(game->getRootNode());
+    return this->endGame();
+}
+
+int DcgEncoder::encodeGame(FlatGame *game, QByteArray *out) {
+    this->beginGame(out, game->getRootBoard());
+    if(game->hasComment(0)) {
+        this->appendComment(game->getComment(0));
+    }
+    this->traversePlies(game, 0);
+    return this->endGame();
+}
+
+void DcgEncoder::beginGame(QByteArray *out, Board *root) {
+    this->gameBytes = out;
+    this->recordStart = out->size();
+    // reserve room for the length prefix, write the body
+    // behind it and fill in the length in endGame()
+    this->lengthReserved = this->lengthHint;
+    out->resize(this->recordStart + this->lengthReserved);
     // add fen string tag if root is not initial position
-    chess::Board* root = game->getRootNode()->getBoard();
     if(!root->is_initial_position()) {
-        const QByteArray fen = root->fen().toUtf8();
-        int l = fen.length();
+        char fen[FEN_MAX_LENGTH];
+        int l = root->fen(fen);
         this->gameBytes->append(quint8(0x01));
         this->appendLength(l);
-        this->gameBytes->append(fen);
+        this->gameBytes->append(fen, l);
     } else {
         this->gameBytes->append((char) (0x00));
     }
-    //qDebug() << "before traversal";
-    // if the root node has a comment, append first
-    if(!(game->getRootNode()->getComment().isEmpty())) {
-        this->appendComment(game->getRootNode());
+}
+
+int DcgEncoder::endGame() {
+    QByteArray *out = this->gameBytes;
+    int start = this->recordStart;
+    int reserved = this->lengthReserved;
+    int l = out->size() - start - reserved;
+    int needed = this->lengthSize(l);
+    if(needed != reserved) {
+        // guessed wrong, shift the body once
+        int bodyStart = start + reserved;
+        if(needed > reserved) {
+            out->resize(out->size() + (needed - reserved));
+        }
+        char *d = out->data();
+        memmove(d + start + needed, d + bodyStart, size_t(l));
+        if(needed < reserved) {
+            out->resize(start + needed + l);
+        }
+        this->lengthHint = needed;
+    }
+    this->writeLength(out->data() + start, l);
+    this->gameBytes = 0;
+    return needed + l;
+}
+
+int DcgEncoder::lengthSize(int len) {
+    if(len < 127) {
+        return 1;
+    } else if(len < 255) {
+        return 2;
+    } else if(len < 65535) {
+        return 3;
+    } else if(len < 16777215) {
+        return 4;
+    } else {
+        return 5;
+    }
+}
+
+void DcgEncoder::writeLength(char *dst, int len) {
+    int n = this->lengthSize(len);
+    if(n == 1) {
+        dst[0] = char(quint8(len));
+        return;
+    }
+    // 0x81 .. 0x84 followed by n-1 bytes, big endian
+    dst[0] = char(quint8(0x80 + n - 1));
+    for(int i=n-1;i>0;i--) {
+        dst[i] = char(quint8(len));
+        len = len >> 8;
     }
-    this->traverseNodes(game->getRootNode());
-    // prepend length
-    int l = this->gameBytes->size();
-    qDebug() << "len: " << l;
-    this->prependLength(l);
-    qDebug() << "game: " << this->gameBytes->toHex();
-    return new QByteArray(*this->gameBytes);
 }
 
 void DcgEncoder::appendMove(Move *move) {
@@ -104,17 +203,18 @@ void DcgEncoder::appendMove(Move *move) {
         quint8 from = fromPoint.y() * 8 + fromPoint.x();
         quint8 to = toPoint.y() * 8 + toPoint.x();
         quint16 move_binary = qint16(to) + (quint16(from) << 6);
-        //qDebug() << "MOVE: "<< (qint16(to) + (quint16(from) << 6));
         if(move->promotion_piece != 0) {
-            qDebug() << "FROM POINT " << fromPoint;
-            qDebug() << "FROM  " << from;
-            qDebug() << "PROMOTION PIECE: "<< quint16((move->promotion_piece) << 12);
-            qDebug() << "promotion move bin: " << move_binary;
             move_binary += quint16((move->promotion_piece) << 12);
-            qDebug() << "promotion move bin: " << move_binary;
         }
         ByteUtil::append_as_uint16(this->gameBytes, move_binary);
-        qDebug() << this->gameBytes->mid(this->gameBytes->length()-2, 2).toHex();
+    }
+}
+
+void DcgEncoder::appendMove(quint16 code) {
+    if(code == FLAT_NULL_MOVE) {
+        this->gameBytes->append(quint8(0x88));
+    } else {
+        ByteUtil::append_as_uint16(this->gameBytes, code);
     }
 }
 
@@ -137,27 +237,11 @@ void DcgEncoder::appendLength(int len) {
     }
 }
 
-void DcgEncoder::prependLength(int len) {
-    if(len >= 0 && len < 127) {
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(len));
-    } else if(len >= 0 && len < 255) {
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(len));
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(0x81));        
-    } else if(len >= 0 && len < 65535) {
-        ByteUtil::prepend_as_uint16(this->gameBytes, quint16(len));
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(0x82));
-    } else if(len >= 0 && len < 16777215) {
-        ByteUtil::prepend_as_uint16(this->gameBytes, quint16(len));
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(len >> 16));
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(0x83));
-    } else if(len >= 0 && len < 4294967) {
-        ByteUtil::prepend_as_uint32(this->gameBytes, quint32(len));
-        ByteUtil::prepend_as_uint8(this->gameBytes, quint8(0x84));
-    }
+void DcgEncoder::appendNags(GameNode* node) {
+    this->appendNags(node->getNags());
 }
 
-void DcgEncoder::appendNags(GameNode* node) {
-    QList<int>* nags = node->getNags();
+void DcgEncoder::appendNags(const QList<int>* nags) {
     int l = nags->length();
     if(l>0) {
         this->gameBytes->append(quint8(0x87));
@@ -170,13 +254,15 @@ void DcgEncoder::appendNags(GameNode* node) {
 }
 
 void DcgEncoder::appendComment(GameNode* node) {
-    const QByteArray comment_utf8 = node->getComment().toUtf8();
+    this->appendComment(node->getComment());
+}
+
+void DcgEncoder::appendComment(const QString &comment) {
+    const QByteArray comment_utf8 = comment.toUtf8();
     int l = comment_utf8.size();
-    qDebug() << "COMMENT LENGTH: " << l;
     if(l>0) {
         this->gameBytes->append(quint8(0x86));
         this->appendLength(l);
-        qDebug() << "COMMENT LEN: " << this->gameBytes->mid(this->gameBytes->size()-4, 4);
         this->gameBytes->append(comment_utf8);
     }
 }
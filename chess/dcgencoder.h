@@ -4,30 +4,63 @@
 #include <QByteArray>
 #include <QQueue>
 #include "game.h"
+#include "flat_game.h"
 
 namespace chess {
 
+// keeps per-game state while encoding, hence an instance must not be
+// used by two threads at once. there is no shared state between
+// instances, and they are cheap to create, so use one per thread
 class DcgEncoder
 {
 public:
     DcgEncoder();
     ~DcgEncoder();
+    // encodes game into a freshly allocated buffer that is handed
+    // over to the caller (who is responsible for deleting it)
     QByteArray* encodeGame(Game *game);
+    // appends the encoded game (length prefix and body) to the end
+    // of out, i.e. a large output block that is written in one go
+    // for a batch of games. returns the number of bytes appended
+    int encodeGame(Game *game, QByteArray *out);
+    // same for a game in flat representation
+    int encodeGame(FlatGame *game, QByteArray *out);
+
+    // low level interface to write a game record into out without
+    // building a Game first: call beginGame() with the starting position,
+    // then append moves, markers, nags and comments in the order
+    // of the record and finish with endGame(), which fills in the
+    // length and returns the number of bytes appended
+    void beginGame(QByteArray *out, Board *root);
+    int endGame();
     QByteArray* encodeHeader();
     void traverseNodes(GameNode *current);
+    void traversePlies(FlatGame *game, int ply);
     void reset();
 
     void appendMove(Move *move);
+    void appendMove(quint16 code);
     void appendLength(int len);
-    void prependLength(int len);
     void appendNags(GameNode* node);
+    void appendNags(const QList<int>* nags);
     void appendComment(GameNode* node);
+    void appendComment(const QString &comment);
 
     void appendStartTag();
     void appendEndTag();
 
 private:
+    // buffer that is currently encoded into; not owned by the encoder
     QByteArray* gameBytes;
+    // number of bytes reserved in front of the body for the length.
+    // taken from the previous game, since games of one batch tend to
+    // have similar size
+    int lengthHint;
+    // start of the record in gameBytes and the room reserved for its length
+    int recordStart;
+    int lengthReserved;
+    int lengthSize(int len);
+    void writeLength(char *dst, int len);
 
 };
 
@@ -11,12 +11,50 @@ struct EcoInfo {
     QString info;
 };
 
+// an entry of the ECO table: polyglot zobrist key of the position,
+// ECO code (e.g. "B90") and name of the opening
+struct EcoEntry {
+    quint64 key;
+    const char *code;
+    const char *info;
+};
+
+// positions of the main line after more plies than this
+// are not classified
+const int ECO_MAX_PLY = 29;
+
 class EcoCode
 {
 public:
     EcoCode();
     EcoInfo* classify(Board *b);
 
+    // entry of the position with the supplied zobrist key, 0 if
+    // there is none. a binary search on a table sorted at compile time
+    static const EcoEntry* lookup(quint64 zobrist);
+
+};
+
+// classifies a game while its main line is replayed, i.e. the position
+// after each ply is passed to addPly(). the deepest position within the
+// first ECO_MAX_PLY plies that is in the table gives the code, as
+// Game::findEco() does it. plies after that cost nothing
+class EcoClassifier
+{
+public:
+    EcoClassifier();
+    // starts over for the next game
+    void reset();
+    // b is the position after the next ply of the main line
+    void addPly(Board *b);
+    // entry of the deepest classified position so far, 0 if none
+    const EcoEntry* getEntry();
+    // number of plies passed to addPly()
+    int getPlies();
+
+private:
+    int plies;
+    const EcoEntry *entry;
 };
 
 }
@@ -0,0 +1,184 @@
+#include "ecoreclassifier.h"
+#include "chess/gamecursor.h"
+#include "chess/importjournal.h"
+#include "chess/ecocode.h"
+#include <QThread>
+#include <QThreadPool>
+#include <QMutexLocker>
+#include <string.h>
+#include <iostream>
+#ifndef Q_OS_WIN
+#include <unistd.h>
+#endif
+
+namespace chess {
+
+EcoReclassifier::EcoReclassifier(Database *db)
+{
+    this->db = db;
+    this->threads = QThread::idealThreadCount();
+    this->games = 0;
+    this->index = 0;
+}
+
+void EcoReclassifier::setThreads(int n) {
+    this->threads = n > 0 ? n : 1;
+}
+
+int EcoReclassifier::getGames() {
+    return this->games;
+}
+
+int EcoReclassifier::reclassify() {
+    this->games = 0;
+    if(this->db->hasPendingImport()) {
+        std::cerr << "Error: an interrupted import must be completed first." << std::endl;
+        return -1;
+    }
+    // the cursor checks that the files exist and are valid
+    GameCursor cursor(this->db);
+    if(cursor.hasError()) {
+        return -1;
+    }
+    QFile index(this->db->getIndexFilename());
+    if(!index.open(QFile::ReadWrite | QFile::Unbuffered)) {
+        std::cerr << "Error: can't open .dci file for writing." << std::endl;
+        return -1;
+    }
+    this->index = &index;
+    QThreadPool pool;
+    pool.setMaxThreadCount(this->threads);
+    // chunks handed to the pool and not collected yet, in database order
+    QList<ReclassifyChunk*> pending;
+    int changed = 0;
+    bool ok = true;
+    bool more = true;
+    while(ok) {
+        // keep all threads busy with a few chunks to spare
+        while(more && pending.size() < this->threads * 4) {
+            ReclassifyChunk *chunk = new ReclassifyChunk();
+            chunk->ok = true;
+            chunk->done = false;
+            while(chunk->ids.size() < RECLASSIFY_CHUNK_GAMES && (more = cursor.next())) {
+                int start = chunk->moves.size();
+                QByteArray fen;
+                try {
+                    fen = cursor.readFen();
+                    cursor.readMainline(&chunk->moves, ECO_MAX_PLY);
+                } catch(std::invalid_argument a) {
+                    std::cerr << "Error: can't decode game " << cursor.index() << ": " << a.what() << std::endl;
+                    chunk->moves.resize(start);
+                    continue;
+                }
+                chunk->starts.append(start);
+                chunk->fens.append(fen);
+                chunk->ids.append(cursor.index());
+                chunk->ecos.append(cursor.entry()->eco, 3);
+            }
+            if(chunk->ids.isEmpty()) {
+                delete chunk;
+                continue;
+            }
+            chunk->starts.append(chunk->moves.size());
+            this->games += chunk->ids.size();
+            pending.append(chunk);
+            pool.start(new ReclassifyTask(this, chunk));
+        }
+        if(pending.isEmpty()) {
+            break;
+        }
+        ReclassifyChunk *chunk = pending.takeFirst();
+        {
+            QMutexLocker lock(&this->mutex);
+            while(!chunk->done) {
+                this->chunkDone.wait(&this->mutex);
+            }
+        }
+        ok = chunk->ok;
+        // keep a loaded index in line with the file
+        for(int i=0;i<chunk->changed.size();i++) {
+            int id = chunk->changed.at(i);
+            if(id < this->db->countGames()) {
+                memcpy(this->db->getIndexEntry(id)->eco, chunk->changedEcos.constData() + 3 * i, 3);
+                this->db->invalidateGame(id);
+            }
+        }
+        changed += chunk->changed.size();
+        delete chunk;
+    }
+    pool.waitForDone();
+    for(int i=0;i<pending.size();i++) {
+        delete pending.at(i);
+    }
+    ok = ok && !cursor.hasError() && ImportJournal::sync(&index);
+    index.close();
+    this->index = 0;
+    if(!ok) {
+        std::cerr << "Error: can't reclassify the database." << std::endl;
+        return -1;
+    }
+    return changed;
+}
+
+bool EcoReclassifier::writeEco(int id, const char *eco) {
+    qint64 pos = INDEX_HEADER_SIZE + qint64(id) * INDEX_ENTRY_SIZE + INDEX_ENTRY_ECO;
+#ifdef Q_OS_WIN
+    // no positioned writes, the workers take turns on the file
+    QMutexLocker lock(&this->mutex);
+    return this->index->seek(pos) && this->index->write(eco, 3) == 3;
+#else
+    return pwrite(this->index->handle(), eco, 3, off_t(pos)) == 3;
+#endif
+}
+
+void EcoReclassifier::classify(ReclassifyChunk *chunk) {
+    Board board;
+    Board start(true);
+    BoardState initial;
+    start.save_state(&initial);
+    EcoClassifier classifier;
+    for(int i=0;i<chunk->ids.size() && chunk->ok;i++) {
+        if(chunk->fens.at(i).isEmpty()) {
+            board.restore_state(initial);
+        } else {
+            try {
+                Board root(chunk->fens.at(i).constData(), chunk->fens.at(i).size());
+                BoardState s;
+                root.save_state(&s);
+                board.restore_state(s);
+            } catch(std::invalid_argument a) {
+                continue;
+            }
+        }
+        classifier.reset();
+        for(int j=chunk->starts.at(i);j<chunk->starts.at(i+1);j++) {
+            board.make(FlatGame::decodeMove(chunk->moves.at(j)));
+            classifier.addPly(&board);
+        }
+        const EcoEntry *e = classifier.getEntry();
+        if(e == 0 || memcmp(e->code, chunk->ecos.constData() + 3 * i, 3) == 0) {
+            continue;
+        }
+        if(!this->writeEco(chunk->ids.at(i), e->code)) {
+            chunk->ok = false;
+            break;
+        }
+        chunk->changed.append(chunk->ids.at(i));
+        chunk->changedEcos.append(e->code, 3);
+    }
+    QMutexLocker lock(&this->mutex);
+    chunk->done = true;
+    this->chunkDone.wakeAll();
+}
+
+ReclassifyTask::ReclassifyTask(EcoReclassifier *reclassifier, ReclassifyChunk *chunk)
+{
+    this->reclassifier = reclassifier;
+    this->chunk = chunk;
+}
+
+void ReclassifyTask::run() {
+    this->reclassifier->classify(this->chunk);
+}
+
+}
@@ -0,0 +1,90 @@
+#ifndef ECORECLASSIFIER_H
+#define ECORECLASSIFIER_H
+
+#include <QByteArray>
+#include <QVector>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QRunnable>
+#include "chess/database.h"
+
+namespace chess {
+
+// number of games a worker classifies in one go
+const int RECLASSIFY_CHUNK_GAMES = 4096;
+// position of the ECO code within an index entry
+const int INDEX_ENTRY_ECO = 32;
+
+// consecutive games of a reclassification: the opening of each game as
+// read by the cursor, and the games whose ECO code was changed
+struct ReclassifyChunk {
+    QVector<int> ids;
+    // FEN of the start position of each game, empty for the initial position
+    QVector<QByteArray> fens;
+    // the first ECO_MAX_PLY main line moves (.dcg encoding) of all games.
+    // those of game i are at starts[i] .. starts[i+1]-1
+    QVector<quint16> moves;
+    QVector<int> starts;
+    // ECO code of each game in the index, three bytes per game
+    QByteArray ecos;
+    // games that got a new code, and the new codes (three bytes each)
+    QVector<int> changed;
+    QByteArray changedEcos;
+    bool ok;
+    bool done;
+};
+
+// sets the ECO code in the index of every game of a database to the
+// code of its main line, cf. EcoClassifier. games are read with a
+// GameCursor, which only takes the first ECO_MAX_PLY main line moves of
+// each record. these are replayed and classified in chunks on a pool of
+// threads, and each worker patches the three bytes of the codes that
+// changed directly in the .dci file. nothing else is written. games the
+// table knows no position of keep their code. if the index of db is
+// loaded, its entries are updated as well
+class EcoReclassifier
+{
+public:
+    EcoReclassifier(Database *db);
+
+    // number of worker threads, the number of cores by default
+    void setThreads(int n);
+
+    // returns the number of games whose code changed, or -1 if the
+    // database can't be read, the index can't be written or an
+    // interrupted import is pending, cf. Database::hasPendingImport()
+    int reclassify();
+    // number of games that were looked at by the last reclassify()
+    int getGames();
+
+    // classifies the games of chunk. called by the workers
+    void classify(ReclassifyChunk *chunk);
+
+private:
+    Database *db;
+    int threads;
+    int games;
+    // the .dci file, opened for writing at positions
+    QFile *index;
+    QMutex mutex;
+    // signalled whenever a chunk is done
+    QWaitCondition chunkDone;
+    bool writeEco(int id, const char *eco);
+};
+
+// worker task that classifies one chunk
+class ReclassifyTask : public QRunnable
+{
+public:
+    ReclassifyTask(EcoReclassifier *reclassifier, ReclassifyChunk *chunk);
+    void run();
+
+private:
+    EcoReclassifier *reclassifier;
+    ReclassifyChunk *chunk;
+};
+
+}
+
+#endif // ECORECLASSIFIER_H
@@ -0,0 +1,246 @@
+#include "flat_game.h"
+#include "game.h"
+#include <QHashIterator>
+#include <QMapIterator>
+#include <stdexcept>
+
+namespace chess {
+
+static BoardState initialState() {
+    Board b(true);
+    BoardState s;
+    b.save_state(&s);
+    return s;
+}
+
+FlatGame::FlatGame()
+{
+    this->headers = new QMap<QString, QString>();
+    this->plies = new QVector<FlatPly>();
+    this->comments = new QHash<int, QString>();
+    this->nags = new QHash<int, QList<int> >();
+    this->root = new Board(true);
+    this->clear();
+}
+
+FlatGame::~FlatGame()
+{
+    delete this->headers;
+    delete this->plies;
+    delete this->comments;
+    delete this->nags;
+    delete this->root;
+}
+
+void FlatGame::clear() {
+    this->headers->clear();
+    this->comments->clear();
+    this->nags->clear();
+    // keeps the capacity, so that a FlatGame
+    // can be reused for many games
+    this->plies->resize(0);
+    FlatPly r;
+    r.move = FLAT_NO_MOVE;
+    r.parent = -1;
+    r.firstChild = -1;
+    r.nextSibling = -1;
+    this->plies->append(r);
+    // the root is reset in place rather than allocated anew
+    static const BoardState initial = initialState();
+    this->root->restore_state(initial);
+    this->result = RES_UNDEF;
+}
+
+void FlatGame::assign(FlatGame *other) {
+    *this->headers = *other->headers;
+    *this->plies = *other->plies;
+    *this->comments = *other->comments;
+    *this->nags = *other->nags;
+    BoardState s;
+    other->root->save_state(&s);
+    this->root->restore_state(s);
+    this->result = other->result;
+}
+
+int FlatGame::memoryUsage() {
+    // per entry overhead of the hash and map nodes
+    const int node = 32;
+    int bytes = int(sizeof(FlatGame) + sizeof(Board));
+    bytes += this->plies->capacity() * int(sizeof(FlatPly));
+    QHashIterator<int, QString> c(*this->comments);
+    while(c.hasNext()) {
+        c.next();
+        bytes += node + c.value().size() * 2;
+    }
+    QHashIterator<int, QList<int> > n(*this->nags);
+    while(n.hasNext()) {
+        n.next();
+        bytes += node + n.value().size() * int(sizeof(int));
+    }
+    QMapIterator<QString, QString> h(*this->headers);
+    while(h.hasNext()) {
+        h.next();
+        bytes += node + (h.key().size() + h.value().size()) * 2;
+    }
+    return bytes;
+}
+
+void FlatGame::setRootBoard(Board *b) {
+    if(b != this->root) {
+        delete this->root;
+        this->root = b;
+    }
+}
+
+Board* FlatGame::getRootBoard() {
+    return this->root;
+}
+
+int FlatGame::getResult() {
+    return this->result;
+}
+
+void FlatGame::setResult(int r) {
+    this->result = r;
+}
+
+int FlatGame::size() {
+    return this->plies->size();
+}
+
+int FlatGame::addPly(int parent, quint16 move) {
+    if(parent < 0 || parent >= this->plies->size()) {
+        throw std::invalid_argument("parent of ply out of range");
+    }
+    int idx = this->plies->size();
+    FlatPly p;
+    p.move = move;
+    p.parent = parent;
+    p.firstChild = -1;
+    p.nextSibling = -1;
+    this->plies->append(p);
+    FlatPly *data = this->plies->data();
+    int c = data[parent].firstChild;
+    if(c < 0) {
+        data[parent].firstChild = idx;
+    } else {
+        while(data[c].nextSibling >= 0) {
+            c = data[c].nextSibling;
+        }
+        data[c].nextSibling = idx;
+    }
+    return idx;
+}
+
+int FlatGame::addPly(int parent, const Move &m) {
+    return this->addPly(parent, FlatGame::encodeMove(m));
+}
+
+quint16 FlatGame::getMoveCode(int ply) {
+    return this->plies->at(ply).move;
+}
+
+Move FlatGame::getMove(int ply) {
+    return FlatGame::decodeMove(this->plies->at(ply).move);
+}
+
+int FlatGame::getParent(int ply) {
+    return this->plies->at(ply).parent;
+}
+
+int FlatGame::getFirstChild(int ply) {
+    return this->plies->at(ply).firstChild;
+}
+
+int FlatGame::getNextSibling(int ply) {
+    return this->plies->at(ply).nextSibling;
+}
+
+const FlatPly& FlatGame::at(int ply) {
+    return this->plies->at(ply);
+}
+
+void FlatGame::setComment(int ply, const QString &comment) {
+    if(comment.isEmpty()) {
+        this->comments->remove(ply);
+    } else {
+        this->comments->insert(ply, comment);
+    }
+}
+
+QString FlatGame::getComment(int ply) {
+    return this->comments->value(ply);
+}
+
+bool FlatGame::hasComment(int ply) {
+    return this->comments->contains(ply);
+}
+
+void FlatGame::addNag(int ply, int nag) {
+    (*this->nags)[ply].append(nag);
+}
+
+const QList<int>* FlatGame::getNags(int ply) {
+    QHash<int, QList<int> >::const_iterator i = this->nags->constFind(ply);
+    if(i == this->nags->constEnd()) {
+        return 0;
+    }
+    return &(i.value());
+}
+
+quint16 FlatGame::encodeMove(const Move &m) {
+    if(m.is_null) {
+        return FLAT_NULL_MOVE;
+    }
+    // internal squares are 21 (a1) .. 98 (h8), cf. Board
+    quint16 from = quint16(((m.from % 10) - 1) + ((m.from / 10) - 2) * 8);
+    quint16 to = quint16(((m.to % 10) - 1) + ((m.to / 10) - 2) * 8);
+    return quint16((quint16(m.promotion_piece) << 12) + (from << 6) + to);
+}
+
+Move FlatGame::decodeMove(quint16 code) {
+    if(code == FLAT_NULL_MOVE || code == FLAT_NO_MOVE) {
+        return Move();
+    }
+    quint8 from = quint8((code >> 6) & 0x3F);
+    quint8 to = quint8(code & 0x3F);
+    quint8 promotion_piece = quint8((code >> 12) & 0x07);
+    quint8 from_internal = ((from % 8) + 1) + (((from / 8) + 2) * 10);
+    quint8 to_internal = ((to % 8) + 1) + (((to / 8) + 2) * 10);
+    if(promotion_piece != 0) {
+        return Move(from_internal, to_internal, promotion_piece);
+    }
+    return Move(from_internal, to_internal);
+}
+
+FlatChildIterator::FlatChildIterator(FlatGame *g, int ply) {
+    this->game = g;
+    this->current = g->getFirstChild(ply);
+}
+
+bool FlatChildIterator::hasNext() {
+    return this->current >= 0;
+}
+
+int FlatChildIterator::next() {
+    int ply = this->current;
+    this->current = this->game->getNextSibling(ply);
+    return ply;
+}
+
+FlatLineIterator::FlatLineIterator(FlatGame *g, int ply) {
+    this->game = g;
+    this->current = g->getFirstChild(ply);
+}
+
+bool FlatLineIterator::hasNext() {
+    return this->current >= 0;
+}
+
+int FlatLineIterator::next() {
+    int ply = this->current;
+    this->current = this->game->getFirstChild(ply);
+    return ply;
+}
+
+}
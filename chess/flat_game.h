@@ -0,0 +1,124 @@
+#ifndef FLAT_GAME_H
+#define FLAT_GAME_H
+
+#include <QVector>
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QList>
+#include "board.h"
+#include "move.h"
+
+namespace chess {
+
+// marks a ply without a move (root) or a null move
+const quint16 FLAT_NO_MOVE = 0xFFFF;
+const quint16 FLAT_NULL_MOVE = 0xFFFE;
+
+// one half move of a FlatGame. relations are indices into
+// the ply array, -1 if there is no such ply
+struct FlatPly {
+    // move as in the .dcg format, i.e. promotion << 12 | from << 6 | to
+    // with squares numbered 0 (a1) .. 63 (h8)
+    quint16 move;
+    qint32 parent;
+    qint32 firstChild;
+    qint32 nextSibling;
+};
+
+// alternative to the pointer tree of Game. all plies are stored in one
+// contiguous array, where ply 0 is the root (before the first move).
+// the children of a ply form a list through firstChild/nextSibling,
+// the first child is the main line continuation. comments and nags are
+// kept in side tables, since most plies have neither. no board is stored
+// per ply; positions are obtained by replaying moves on one board
+class FlatGame
+{
+public:
+    FlatGame();
+    ~FlatGame();
+
+    QMap<QString, QString>* headers;
+
+    // removes all plies, comments, nags and headers
+    // and resets the root to the initial position
+    void clear();
+
+    // makes this a copy of other. the ply array and side tables
+    // are implicitly shared until one of the games is modified
+    void assign(FlatGame *other);
+
+    // approximate number of bytes held by the game
+    int memoryUsage();
+
+    // takes ownership of b
+    void setRootBoard(Board *b);
+    Board* getRootBoard();
+
+    int getResult();
+    void setResult(int r);
+
+    // number of plies including the root
+    int size();
+    // appends a ply with the given move as last child of parent
+    // and returns its index
+    int addPly(int parent, quint16 move);
+    int addPly(int parent, const Move &m);
+
+    quint16 getMoveCode(int ply);
+    // move of ply as used by Board
+    Move getMove(int ply);
+    int getParent(int ply);
+    int getFirstChild(int ply);
+    int getNextSibling(int ply);
+    const FlatPly& at(int ply);
+
+    void setComment(int ply, const QString &comment);
+    QString getComment(int ply);
+    bool hasComment(int ply);
+
+    void addNag(int ply, int nag);
+    // returns 0 if ply has no nags
+    const QList<int>* getNags(int ply);
+
+    static quint16 encodeMove(const Move &m);
+    static Move decodeMove(quint16 code);
+
+private:
+    QVector<FlatPly> *plies;
+    QHash<int, QString> *comments;
+    QHash<int, QList<int> > *nags;
+    Board *root;
+    int result;
+};
+
+// iterates over the children of a ply, the
+// main line continuation first, then all variations
+class FlatChildIterator
+{
+public:
+    FlatChildIterator(FlatGame *g, int ply);
+    bool hasNext();
+    int next();
+private:
+    FlatGame *game;
+    int current;
+};
+
+// iterates along a line, i.e. follows the first child
+// of each ply starting after ply until the end of the line.
+// with ply = 0 this walks the main line of the game
+class FlatLineIterator
+{
+public:
+    FlatLineIterator(FlatGame *g, int ply);
+    bool hasNext();
+    int next();
+private:
+    FlatGame *game;
+    int current;
+};
+
+}
+
+#endif // FLAT_GAME_H
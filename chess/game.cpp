@@ -24,9 +24,19 @@
 
 namespace chess {
 
-Game::Game() {
+Game::Game() : Game(false) {
+}
+
+Game::Game(bool useArena) {
 
-    this->root = new GameNode();
+    if(useArena) {
+        this->arena = new Arena();
+        this->root = this->arena->make<GameNode>(this->arena);
+        this->root->setBoard(this->arena->make<Board>(true));
+    } else {
+        this->arena = 0;
+        this->root = new GameNode();
+    }
     this->headers = new QMap<QString, QString>();
     this->result = RES_UNDEF;
     this->current = root;
@@ -34,17 +44,86 @@ Game::Game() {
 
     this->wasEcoClassified = false;
     this->ecoInfo = new EcoInfo{"",""};
+    this->boardCheckpoints = useArena ? ARENA_BOARD_CHECKPOINTS : 0;
 
 }
 
 Game::~Game() {
     this->headers->clear();
     delete this->headers;
-    this->delBelow(this->root);
-    delete this->root;
+    if(this->arena != 0) {
+        // releases the whole tree at once
+        delete this->arena;
+    } else {
+        this->delBelow(this->root);
+        delete this->root;
+    }
     delete this->ecoInfo;
 }
 
+Arena* Game::getArena() {
+    return this->arena;
+}
+
+GameNode* Game::createNode() {
+    if(this->arena != 0) {
+        return this->arena->make<GameNode>(this->arena);
+    } else {
+        return new GameNode();
+    }
+}
+
+Move* Game::createMove(const Move &m) {
+    if(this->arena != 0) {
+        return this->arena->make<Move>(m);
+    } else {
+        return new Move(m);
+    }
+}
+
+Board* Game::createBoard(Board *b, const Move &m) {
+    if(this->arena != 0) {
+        return b->copy_and_apply(m, this->arena);
+    } else {
+        return b->copy_and_apply(m);
+    }
+}
+
+void Game::setBoardCheckpoints(int plies) {
+    this->boardCheckpoints = plies;
+}
+
+int Game::getBoardCheckpoints() {
+    return this->boardCheckpoints;
+}
+
+void Game::releaseBoards() {
+    if(this->boardCheckpoints <= 0 || this->arena != 0) {
+        return;
+    }
+    QList<GameNode*> nodes;
+    QList<int> depths;
+    nodes.append(this->root);
+    depths.append(0);
+    while(!nodes.isEmpty()) {
+        GameNode *node = nodes.takeLast();
+        int depth = depths.takeLast();
+        if(depth % this->boardCheckpoints != 0) {
+            node->releaseBoard();
+        }
+        for(int i=0;i<node->getVariations()->size();i++) {
+            nodes.append(node->getVariation(i));
+            depths.append(depth + 1);
+        }
+    }
+}
+
+void Game::destroyNode(GameNode *node) {
+    if(this->arena == 0) {
+        delete node;
+    }
+}
+
 GameNode* Game::getRootNode() {
     return this->root;
 }
@@ -135,14 +214,17 @@ void Game::goToRoot() {
 void Game::resetWithNewRootBoard(chess::Board *new_root_board) {
     chess::GameNode* old_root = this->getRootNode();
     this->delBelow(old_root);
-    chess::GameNode* new_root = new chess::GameNode();
+    chess::GameNode* new_root = this->createNode();
+    if(this->arena != 0) {
+        this->arena->adopt(new_root_board);
+    }
     new_root->setBoard(new_root_board);
     this->setRoot(new_root);
     this->setCurrent(new_root);
     this->result = RES_UNDEF;
     this->clearHeaders();
     this->treeWasChanged = true;
-    delete old_root;
+    this->destroyNode(old_root);
 }
 
 void Game::clearHeaders() {
@@ -175,10 +257,15 @@ void Game::applyMove(Move *m) {
     if(!exists_child) {
         GameNode *current = this->getCurrentNode();
         Board *b_current = current->getBoard();
-        Board *b_child = b_current->copy_and_apply(*m);
-        GameNode *new_current = new GameNode();
+        Board *b_child = this->createBoard(b_current, *m);
+        GameNode *new_current = this->createNode();
         new_current->setBoard(b_child);
-        new_current->setMove(m);
+        if(this->arena != 0) {
+            new_current->setMove(this->createMove(*m));
+            delete m;
+        } else {
+            new_current->setMove(m);
+        }
         new_current->setParent(current);
         current->getVariations()->append(new_current);
         this->current = new_current;
@@ -228,7 +315,7 @@ void Game::delVariant(GameNode *node) {
     }
     if(idx != -1) {
         var_root->getVariations()->removeAt(idx);
-        delete child;
+        this->destroyNode(child);
         this->current = var_root;
     }
 }
@@ -237,7 +324,7 @@ void Game::delBelow(GameNode *node) {
     for(int i=0;i<node->getVariations()->size();i++) {
         GameNode *child_i = node->getVariations()->at(i);
         node->getVariations()->removeAt(i);
-        delete child_i;
+        this->destroyNode(child_i);
     }
     this->current = node;
 }
@@ -263,7 +350,7 @@ void Game::removeAllVariants() {
         // delete all variants
         for(int i=1;i<size;i++) {
             GameNode *ni = temp->getVariations()->at(i);
-            delete ni;
+            this->destroyNode(ni);
         }
         temp->getVariations()->clear();
         temp->addVariation(main);
@@ -275,32 +362,25 @@ void Game::removeAllVariants() {
 
 void Game::findEco() {
 
-    EcoCode *ec = new EcoCode();
+    // classify the positions of the main line from the
+    // start, the deepest one in the table wins
+    EcoClassifier classifier;
     GameNode* temp = this->getRootNode();
-    int depth = 0;
-    while(depth < 29 && temp->getVariations()->count() > 0) {
+    while(classifier.getPlies() < ECO_MAX_PLY && temp->getVariations()->count() > 0) {
         temp = temp->getVariation(0);
-        depth++;
+        classifier.addPly(temp->getBoard());
     }
-    int maxdepth = depth;
-    while(depth >= 2)  {
-        EcoInfo *e_temp = ec->classify(temp->getBoard());
-        if(!e_temp->code.isEmpty()) {
-            this->ecoInfo = e_temp;
-            this->wasEcoClassified = true;
-            this->headers->insert("ECO", e_temp->code);
-            delete ec;
-            break;
-        } else {
-            delete e_temp;
-            temp = temp->getParent();
-            depth--;
-        }
+    const EcoEntry *e = classifier.getEntry();
+    if(e != 0) {
+        this->ecoInfo->code = e->code;
+        this->ecoInfo->info = e->info;
+        this->wasEcoClassified = true;
+        this->headers->insert("ECO", this->ecoInfo->code);
     }
     // we consider this a failed attempt
     // if we haven't found a code, and the game
     // is sufficiently long
-    if(maxdepth > 4 && !this->wasEcoClassified) {
+    if(classifier.getPlies() > 4 && !this->wasEcoClassified) {
         this->wasEcoClassified = true;
         this->ecoInfo->code = "A00";
         this->ecoInfo->info = "Unknown";
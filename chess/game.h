@@ -31,6 +31,11 @@ const int RES_WHITE_WINS = 1;
 const int RES_BLACK_WINS = 2;
 const int RES_DRAW = 3;
 
+// board checkpoints of games with an arena, cf. Game::setBoardCheckpoints().
+// each board holds a transposition table on the heap that is released
+// on its own, so an arena game keeps only every eighth one
+const int ARENA_BOARD_CHECKPOINTS = 8;
+
 class Game
 {
 
@@ -60,8 +65,67 @@ public:
      *             board position which is empty
      */
     Game();
+
+    /**
+     * @brief Game as above. If useArena is true, all nodes, moves and boards
+     *             of the game are allocated from one arena, and released
+     *             at once when the game is deleted. Use createNode(),
+     *             createMove() and createBoard() to extend the tree of
+     *             such a game. Board checkpoints are set to
+     *             ARENA_BOARD_CHECKPOINTS for such a game.
+     */
+    Game(bool useArena);
     ~Game();
 
+    /**
+     * @brief getArena returns the arena of the game, null if the game
+     *                 was created without one
+     */
+    Arena* getArena();
+
+    /**
+     * @brief createNode returns a new node for this game, allocated
+     *                   from the arena, if any. Nodes of an arena game have
+     *                   no board until setBoard() is called.
+     */
+    GameNode* createNode();
+
+    /**
+     * @brief createMove returns a copy of m allocated for this game
+     */
+    Move* createMove(const Move &m);
+
+    /**
+     * @brief createBoard returns a copy of b with m applied, allocated for this game
+     */
+    Board* createBoard(Board *b, const Move &m);
+
+    /**
+     * @brief setBoardCheckpoints if plies > 0, only every plies-th node (counted
+     *                     from the root) stores its board when the game is decoded.
+     *                     All other nodes store just the move; their boards are
+     *                     reconstructed by GameNode::getBoard() when needed. 0 (the
+     *                     default) stores a board in every node.
+     */
+    void setBoardCheckpoints(int plies);
+
+    int getBoardCheckpoints();
+
+    /**
+     * @brief releaseBoards drops the boards of all nodes that are not
+     *                      checkpoints (cf. setBoardCheckpoints()), e.g. after
+     *                      the game was printed. No effect if checkpoints are off,
+     *                      or for games with an arena, whose memory is only
+     *                      reclaimed with the game.
+     */
+    void releaseBoards();
+
+    /**
+     * @brief destroyNode deletes node and all its children. For games with
+     *                    an arena, the memory is only released with the game.
+     */
+    void destroyNode(GameNode *node);
+
     /**
      * @brief getRootNode returns the root node of the game
      * @return
@@ -246,6 +310,9 @@ private:
 
     EcoInfo* ecoInfo;
 
+    Arena* arena;
+    int boardCheckpoints;
+
 };
 
 }
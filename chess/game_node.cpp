@@ -19,6 +19,7 @@
 
 
 #include "game_node.h"
+#include <QVector>
 #include <QDebug>
 #include <iostream>
 #include <assert.h>
@@ -26,48 +27,88 @@
 
 namespace chess {
 
-int GameNode::id = 0;
+QAtomicInt GameNode::id(0);
+
+NodeAnnotations::~NodeAnnotations() {
+    for(int i=0;i<this->arrows.size();i++) {
+        delete this->arrows.at(i);
+    }
+    for(int i=0;i<this->coloredFields.size();i++) {
+        delete this->coloredFields.at(i);
+    }
+}
 
 GameNode::GameNode() {
 
-    this->variations = new QList<GameNode*>();
-    this->board = new Board(true);
-    this->comment = QString("");
-    this->nags = new QList<int>();
+    this->board = 0;
+    this->parent = 0;
+    this->m = 0;
+    this->nodeId = this->initId();
+    this->annotations = 0;
+    this->depthCache = 0;
+    this->revision = 0;
+    this->userWasInformedAboutResult = false;
+    this->arena = 0;
+
+}
+
+GameNode::GameNode(Arena *arena) {
+
+    this->board = 0;
     this->parent = 0;
     this->m = 0;
     this->nodeId = this->initId();
-    this->san_cache = QString("");
-    this->arrows = new QList<Arrow*>();
-    this->coloredFields = new QList<ColoredField*>();
+    this->annotations = 0;
     this->depthCache = 0;
+    this->revision = 0;
     this->userWasInformedAboutResult = false;
+    this->arena = arena;
 
 }
 
 GameNode::~GameNode() {
+    if(this->arena != 0) {
+        // children, move, board and annotations
+        // are destroyed by the arena
+        return;
+    }
     delete this->m;
-    for(int i=0;i<this->arrows->size();i++) {
-        delete this->arrows->at(i);
+    delete this->annotations;
+    delete this->board;
+    for(int i=0;i<this->variations.size();i++) {
+        delete this->variations.at(i);
     }
-    delete this->arrows;
+    this->variations.clear();
+}
 
-    for(int i=0;i<this->coloredFields->size();i++) {
-        delete this->coloredFields->at(i);
-    }
-    delete this->coloredFields;
-    delete this->nags;
-    delete this->board;
-    for(int i=0;i<this->variations->size();i++) {
-        delete this->variations->at(i);
+NodeAnnotations* GameNode::getAnnotations() {
+    if(this->annotations == 0) {
+        if(this->arena != 0) {
+            this->annotations = this->arena->make<NodeAnnotations>();
+        } else {
+            this->annotations = new NodeAnnotations();
+        }
     }
-    this->variations->clear();
-    delete this->variations;
+    return this->annotations;
+}
+
+bool GameNode::hasAnnotations() {
+    return this->annotations != 0;
 }
 
 void GameNode::setMove(Move *m) {
     assert(m!=0);
     this->m = m;
+    this->changed();
+}
+
+void GameNode::changed() {
+    this->san_cache = QString();
+    this->revision++;
+}
+
+int GameNode::getRevision() {
+    return this->revision;
 }
 
 int GameNode::getDepth() {
@@ -86,7 +127,7 @@ QString GameNode::getSan() {
     if(this->san_cache.isEmpty() && this->parent != 0) {
         Board *b = this->parent->getBoard();
         Move *m = this->m;
-        //qDebug() << "node to: " << m->uci_string;
+        //qDebug() << "node to: " << m->uci();
         //QString foo = m->uci();
         //qDebug() << foo;
         this->san_cache = b->san(*m);
@@ -103,7 +144,10 @@ Move* GameNode::getMove() {
 }
 
 void GameNode::setParent(GameNode *p) {
-    this->parent = p;
+    if(this->parent != p) {
+        this->parent = p;
+        this->changed();
+    }
 }
 
 GameNode* GameNode::getParent() {
@@ -112,30 +156,91 @@ GameNode* GameNode::getParent() {
 }
 
 void GameNode::addNag(int n) {
-    this->nags->append(n);
+    this->getAnnotations()->nags.append(n);
+    this->revision++;
 }
 
-QList<int>* GameNode::getNags() {
-    return this->nags;
+const QList<int>* GameNode::getNags() {
+    if(this->annotations == 0) {
+        static const QList<int> noNags;
+        return &noNags;
+    }
+    return &this->annotations->nags;
 }
 
 void GameNode::setComment(QString &c) {
-    this->comment = c;
+    if(this->annotations == 0 && c.isEmpty()) {
+        return;
+    }
+    this->getAnnotations()->comment = c;
+    this->revision++;
 }
 
 QString GameNode::getComment() {
-    return this->comment;
+    if(this->annotations == 0) {
+        return QString();
+    }
+    return this->annotations->comment;
 }
 
 Board* GameNode::getBoard() {
-    assert(this->board != 0);
+    if(this->board == 0) {
+        this->materializeBoard();
+    }
     return this->board;
 }
 
+bool GameNode::hasBoard() {
+    return this->board != 0;
+}
+
+void GameNode::releaseBoard() {
+    if(this->parent == 0 || this->arena != 0) {
+        return;
+    }
+    delete this->board;
+    this->board = 0;
+}
+
+void GameNode::materializeBoard() {
+    if(this->parent == 0) {
+        if(this->arena != 0) {
+            this->board = this->arena->make<Board>(true);
+        } else {
+            this->board = new Board(true);
+        }
+        return;
+    }
+    // collect the moves up to the nearest ancestor with a
+    // board, then replay them on a copy of that board
+    QVector<Move*> moves;
+    GameNode *ancestor = this;
+    while(ancestor->board == 0 && ancestor->parent != 0) {
+        moves.append(ancestor->m);
+        ancestor = ancestor->parent;
+    }
+    Board *b = 0;
+    if(this->arena != 0) {
+        b = ancestor->getBoard()->copy_and_apply(*moves.last(), this->arena);
+    } else {
+        b = ancestor->getBoard()->copy_and_apply(*moves.last());
+    }
+    for(int i=moves.size()-2;i>=0;i--) {
+        b->apply_and_record(*moves.at(i));
+    }
+    this->board = b;
+}
+
 void GameNode::setBoard(Board *b) {
     assert(b != 0);
-    delete this->board;
+    if(this->arena == 0) {
+        delete this->board;
+    }
     this->board = b;
+    // the moves of the children are now played from this board
+    for(int i=0;i<this->variations.size();i++) {
+        this->variations.at(i)->changed();
+    }
 }
 
 
@@ -148,13 +253,13 @@ GameNode* GameNode::root() {
 }
 
 QList<GameNode*>* GameNode::getVariations() {
-    return this->variations;
+    return &this->variations;
 }
 
 
 GameNode* GameNode::getVariation(int i) {
-    assert(this->variations->size() > i);
-    return this->variations->at(i);
+    assert(this->variations.size() > i);
+    return this->variations.at(i);
 }
 
 bool GameNode::hasVariations() {
@@ -163,20 +268,28 @@ bool GameNode::hasVariations() {
 
 void GameNode::addVariation(GameNode *g) {
     assert(g != 0);
-    this->variations->append(g);
-    g->parent = this;
+    this->variations.append(g);
+    g->setParent(this);
 }
 
-QList<Arrow*>* GameNode::getArrows() {
-    return this->arrows;
+const QList<Arrow*>* GameNode::getArrows() {
+    if(this->annotations == 0) {
+        static const QList<Arrow*> noArrows;
+        return &noArrows;
+    }
+    return &this->annotations->arrows;
 }
 
-QList<ColoredField*>* GameNode::getColoredFields() {
-    return this->coloredFields;
+const QList<ColoredField*>* GameNode::getColoredFields() {
+    if(this->annotations == 0) {
+        static const QList<ColoredField*> noFields;
+        return &noFields;
+    }
+    return &this->annotations->coloredFields;
 }
 
 bool GameNode::isLeaf() {
-    if(this->variations->count() == 0) {
+    if(this->variations.count() == 0) {
         return true;
     } else {
         return false;
@@ -184,23 +297,24 @@ bool GameNode::isLeaf() {
 }
 
 void GameNode::addOrDelArrow(Arrow *a) {
+    QList<Arrow*> *arrows = &this->getAnnotations()->arrows;
     bool addArrow = true;
-    for(int i=0;i<this->arrows->size();i++) {
-        Arrow *ai = this->arrows->at(i);
+    for(int i=0;i<arrows->size();i++) {
+        Arrow *ai = arrows->at(i);
         if(ai->from.x() == a->from.x() && ai->from.y() == a->from.y()
                 && ai->to.x() == a->to.x() && a->to.y() == ai->to.y()) {
             if(a->color == ai->color) {
-                this->arrows->removeAt(i);
+                arrows->removeAt(i);
                 addArrow = false;
                 break;
             } else {
-                this->arrows->removeAt(i);
+                arrows->removeAt(i);
                 break;
             }
         }
     }
     if(addArrow) {
-        this->arrows->append(a);
+        arrows->append(a);
     } else {
         delete a;
     }
@@ -208,22 +322,23 @@ void GameNode::addOrDelArrow(Arrow *a) {
 
 void GameNode::addOrDelColoredField(ColoredField *c) {
     assert(c != 0);
+    QList<ColoredField*> *coloredFields = &this->getAnnotations()->coloredFields;
     bool addField = true;
-    for(int i=0;i<this->coloredFields->size();i++) {
-        ColoredField *ci = this->coloredFields->at(i);
+    for(int i=0;i<coloredFields->size();i++) {
+        ColoredField *ci = coloredFields->at(i);
         if(ci->field.x() == c->field.x() && ci->field.y() == c->field.y()) {
             if(ci->color == c->color) {
-                this->coloredFields->removeAt(i);
+                coloredFields->removeAt(i);
                 addField = false;
                 break;
             } else {
-                this->coloredFields->removeAt(i);
+                coloredFields->removeAt(i);
                 break;
             }
         }
     }
     if(addField) {
-        this->coloredFields->append(c);
+        coloredFields->append(c);
     } else {
         delete c;
     }
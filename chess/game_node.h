@@ -23,8 +23,10 @@
 
 #include "board.h"
 #include "move.h"
+#include "arena.h"
 #include <QtGui/QColor>
 #include <QPoint>
+#include <QAtomicInt>
 
 namespace chess {
 
@@ -39,6 +41,20 @@ struct ColoredField {
     QColor color;
 };
 
+/**
+ * @brief NodeAnnotations holds the comment, NAGs, arrows and colored fields
+ *        of a node. Most nodes have none of them, so this is only allocated
+ *        for a node once the first annotation is added. Arrows and colored
+ *        fields are owned and deleted with it.
+ */
+struct NodeAnnotations {
+    QString comment;
+    QList<int> nags;
+    QList<Arrow*> arrows;
+    QList<ColoredField*> coloredFields;
+    ~NodeAnnotations();
+};
+
 class GameNode
 {
 
@@ -46,6 +62,16 @@ public:
 
     GameNode();
 
+    /**
+     * @brief GameNode creates a node whose lists are placed in arena. The node
+     *        itself must be created with arena->make<GameNode>(arena), and
+     *        children, move and board must live in the same arena (cf.
+     *        Game::createNode()). Such a node has no board until
+     *        setBoard() is called.
+     * @param arena the arena of the game
+     */
+    GameNode(Arena *arena);
+
     /**
      * @brief The destructor does NOT delete child nodes. You
      *        are responsible yourself for deleting child nodes.
@@ -62,11 +88,28 @@ public:
     int getId();
 
     /**
-     * @brief getBoard
+     * @brief getBoard returns the board of the node. If the node has no
+     *                 board (yet), it is created by replaying the moves from
+     *                 the nearest ancestor that has one, and kept for
+     *                 subsequent calls. The root defaults to the initial position.
      * @return Board of current node
      */
     Board* getBoard();
 
+    /**
+     * @brief hasBoard checks whether the board of this node is currently
+     *                 stored, i.e. getBoard() won't have to replay moves
+     */
+    bool hasBoard();
+
+    /**
+     * @brief releaseBoard drops the board of this node. It is reconstructed
+     *                     on the next call to getBoard(). Does nothing
+     *                     for the root node, or for nodes of an arena,
+     *                     where the board would only be allocated anew.
+     */
+    void releaseBoard();
+
     /**
      * @brief setBoard deletes the old board of this node, and sets
      *                 the supplied board as the new one. Does no
@@ -82,6 +125,16 @@ public:
      */
     QString getSan();
 
+    /**
+     * @brief getRevision returns a counter that is increased whenever
+     *                    the move, comment or nags of this node change, or
+     *                    the position before the move (i.e. parent or
+     *                    parent's board) changes. Printers compare it to
+     *                    detect stale output they cached for this node.
+     * @return revision of the node
+     */
+    int getRevision();
+
     /**
      * @brief root returns root node of the game
      * @return the root node
@@ -178,21 +231,27 @@ public:
      * @brief getNags returns all numeric annotation glyphs (see PGN standard)
      * @return list with all NAGs
      */
-    QList<int> *getNags();
+    const QList<int> *getNags();
 
     /**
      * @brief getArrows returns a list with all arrows for this node.
      *        Arrows are just annotations done by the user for illustrations.
      * @return list of arrows
      */
-    QList<Arrow*>* getArrows();
+    const QList<Arrow*>* getArrows();
 
     /**
      * @brief getColoredFields returns list of colored fields. Such fields
      *        are juts highlighted fields done by the user for illustration.
      * @return list of color fields
      */
-    QList<ColoredField*> *getColoredFields();
+    const QList<ColoredField*> *getColoredFields();
+
+    /**
+     * @brief hasAnnotations true if a comment, NAG, arrow or colored
+     *        field was ever added to this node
+     */
+    bool hasAnnotations();
 
     /**
      * @brief addOrDelArrow adds (if the supplied arrow does not exist) or removes
@@ -213,21 +272,28 @@ public:
     bool userWasInformedAboutResult;
 
 protected:
-    static int initId() { return id++; }
+    // ids are unique across all threads, so that
+    // games can be built concurrently
+    static int initId() { return id.fetchAndAddRelaxed(1); }
 
 private:
-    QList<Arrow*> *arrows;
-    QList<ColoredField*> *coloredFields;
+    void materializeBoard();
+    NodeAnnotations* getAnnotations();
+    // null as long as the node has no annotations
+    NodeAnnotations *annotations;
     QString san_cache;
-    static int id;
+    int revision;
+    void changed();
+    static QAtomicInt id;
     int nodeId;
     Move* m;
-    QList<GameNode*> *variations;
-    QList<int> *nags;
+    QList<GameNode*> variations;
     Board* board;
-    QString comment;
     GameNode* parent;
     int depthCache;
+    // non-null if the node, its children, move and board are
+    // owned by an arena (and hence must not be deleted)
+    Arena *arena;
 
 };
 
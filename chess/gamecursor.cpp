@@ -0,0 +1,217 @@
+#include "gamecursor.h"
+#include <string.h>
+#include <iostream>
+
+namespace chess {
+
+GameCursor::GameCursor(Database *db, bool headersOnly)
+{
+    this->db = db;
+    this->headersOnly = headersOnly;
+    this->error = false;
+    this->indexFile = new QFile(db->getIndexFilename());
+    this->gamesFile = new QFile(db->getGamesFilename());
+    this->indexBuffer = new QByteArray();
+    this->indexPos = 0;
+    this->gamesBuffer = new QByteArray();
+    this->gamesBufferStart = 0;
+    this->current = new IndexEntry();
+    this->currentIndex = -1;
+    this->currentRecord = 0;
+    this->currentRecordSize = 0;
+    this->currentPrefixSize = 0;
+    this->decoder = new DcgDecoder();
+
+    if(!this->indexFile->open(QFile::ReadOnly)) {
+        std::cerr << "Error: can't open .dci file." << std::endl;
+        this->error = true;
+        return;
+    }
+    QByteArray header = this->indexFile->read(INDEX_HEADER_SIZE);
+    if(header.size() != INDEX_HEADER_SIZE || header.left(10) != QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x69")
+            || header.at(10) != 0x00) {
+        std::cerr << "Error: not a valid .dci file." << std::endl;
+        this->error = true;
+        return;
+    }
+    if(!headersOnly && !this->gamesFile->open(QFile::ReadOnly)) {
+        std::cerr << "Error: can't open .dcg file." << std::endl;
+        this->error = true;
+    }
+}
+
+GameCursor::~GameCursor()
+{
+    this->indexFile->close();
+    this->gamesFile->close();
+    delete this->indexFile;
+    delete this->gamesFile;
+    delete this->indexBuffer;
+    delete this->gamesBuffer;
+    delete this->current;
+    delete this->decoder;
+}
+
+bool GameCursor::fillIndex() {
+    // keep a partially read entry, then read the next chunk behind it
+    int left = this->indexBuffer->size() - this->indexPos;
+    int chunk = CURSOR_INDEX_ENTRIES * INDEX_ENTRY_SIZE;
+    if(left > 0) {
+        memmove(this->indexBuffer->data(), this->indexBuffer->constData() + this->indexPos, size_t(left));
+    }
+    this->indexBuffer->resize(left + chunk);
+    qint64 n = this->indexFile->read(this->indexBuffer->data() + left, chunk);
+    if(n < 0) {
+        n = 0;
+    }
+    this->indexBuffer->resize(left + int(n));
+    this->indexPos = 0;
+    return this->indexBuffer->size() >= INDEX_ENTRY_SIZE;
+}
+
+size_t GameCursor::availableGames(qint64 offset, size_t n) {
+    // returns the number of bytes of the .dcg file available in the
+    // buffer from offset on. if that is less than n, the buffer is
+    // refilled starting at offset with at least n bytes (or up to
+    // the end of the file)
+    qint64 end = this->gamesBufferStart + this->gamesBuffer->size();
+    if(offset >= this->gamesBufferStart && offset + qint64(n) <= end) {
+        return size_t(end - offset);
+    }
+    int chunk = int(n) > CURSOR_READ_SIZE ? int(n) : CURSOR_READ_SIZE;
+    if(this->gamesFile->pos() != offset && !this->gamesFile->seek(offset)) {
+        this->gamesBuffer->resize(0);
+        return 0;
+    }
+    this->gamesBuffer->resize(chunk);
+    qint64 read = this->gamesFile->read(this->gamesBuffer->data(), chunk);
+    if(read < 0) {
+        read = 0;
+    }
+    this->gamesBuffer->resize(int(read));
+    this->gamesBufferStart = offset;
+    return size_t(read);
+}
+
+bool GameCursor::loadRecord() {
+    qint64 offset = qint64(this->current->gameOffset);
+    // at most five bytes for the length
+    size_t available = this->availableGames(offset, 5);
+    if(available == 0) {
+        return false;
+    }
+    const uint8_t *start = reinterpret_cast<const uint8_t*>(this->gamesBuffer->constData()) + (offset - this->gamesBufferStart);
+    size_t idx = 0;
+    size_t length = 0;
+    try {
+        // the record itself may not be buffered yet
+        length = this->decoder->decodeLengthField(start, available, &idx);
+    } catch(std::invalid_argument a) {
+        std::cerr << a.what() << std::endl;
+        return false;
+    }
+    if(idx + length > available) {
+        available = this->availableGames(offset, idx + length);
+        if(idx + length > available) {
+            return false;
+        }
+        start = reinterpret_cast<const uint8_t*>(this->gamesBuffer->constData());
+    }
+    this->currentRecord = start + idx;
+    this->currentRecordSize = length;
+    this->currentPrefixSize = idx;
+    return true;
+}
+
+bool GameCursor::next() {
+    while(!this->error) {
+        if(this->indexPos + INDEX_ENTRY_SIZE > this->indexBuffer->size() && !this->fillIndex()) {
+            return false;
+        }
+        this->current->read(reinterpret_cast<const uint8_t*>(this->indexBuffer->constData()) + this->indexPos);
+        this->indexPos += INDEX_ENTRY_SIZE;
+        this->currentIndex++;
+        this->currentRecord = 0;
+        this->currentRecordSize = 0;
+        this->currentPrefixSize = 0;
+        if(this->current->deleted) {
+            continue;
+        }
+        if(!this->headersOnly && !this->loadRecord()) {
+            std::cerr << "Error: can't read game " << this->currentIndex << " from .dcg file." << std::endl;
+            this->error = true;
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool GameCursor::hasError() {
+    return this->error;
+}
+
+int GameCursor::index() {
+    return this->currentIndex;
+}
+
+IndexEntry* GameCursor::entry() {
+    return this->current;
+}
+
+int GameCursor::readHeaders(QMap<QString, QString> *headers) {
+    return this->db->readHeaders(this->current, headers);
+}
+
+const uint8_t* GameCursor::record() {
+    return this->currentRecord;
+}
+
+size_t GameCursor::recordSize() {
+    return this->currentRecordSize;
+}
+
+const uint8_t* GameCursor::rawRecord() {
+    if(this->currentRecord == 0) {
+        return 0;
+    }
+    return this->currentRecord - this->currentPrefixSize;
+}
+
+size_t GameCursor::rawRecordSize() {
+    return this->currentPrefixSize + this->currentRecordSize;
+}
+
+int GameCursor::readMainline(QVector<quint16> *moves, int maxMoves) {
+    if(this->currentRecord == 0) {
+        return 0;
+    }
+    return this->decoder->decodeMainline(this->currentRecord, this->currentRecordSize, moves, maxMoves);
+}
+
+QByteArray GameCursor::readFen() {
+    if(this->currentRecord == 0) {
+        return QByteArray();
+    }
+    return this->decoder->decodeFen(this->currentRecord, this->currentRecordSize);
+}
+
+FlatGame* GameCursor::readGame(FlatGame *g) {
+    if(this->currentRecord != 0) {
+        this->decoder->decodeGame(g, this->currentRecord, this->currentRecordSize);
+    } else {
+        g->clear();
+    }
+    g->setResult(this->readHeaders(g->headers));
+    return g;
+}
+
+Game* GameCursor::readGame(Game *g) {
+    g->setResult(this->readHeaders(g->headers));
+    if(this->currentRecord != 0) {
+        this->decoder->decodeGame(g, this->currentRecord, this->currentRecordSize);
+    }
+    return g;
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef GAMECURSOR_H
+#define GAMECURSOR_H
+
+#include <QFile>
+#include <QByteArray>
+#include <QVector>
+#include "chess/database.h"
+#include "chess/indexentry.h"
+#include "chess/dcgdecoder.h"
+#include "chess/flat_game.h"
+
+namespace chess {
+
+// number of bytes requested from the .dcg file per read
+const int CURSOR_READ_SIZE = 1 << 20;
+// number of index entries requested from the .dci file per read
+const int CURSOR_INDEX_ENTRIES = 16384;
+
+// forward cursor over all games of a database. the .dci file and (unless
+// headersOnly is set) the .dcg file are read in large sequential chunks,
+// with one file handle each for the lifetime of the cursor. for each game
+// the cursor provides the index entry and a view of the encoded record,
+// both point into the read buffers and are only valid until next().
+// games are only decoded on request, either completely or just the main line.
+// names, sites and events must have been loaded into the database
+// if headers are requested. deleted games are skipped
+class GameCursor
+{
+public:
+    GameCursor(Database *db, bool headersOnly = false);
+    ~GameCursor();
+
+    // advances to the next game. returns false at the end
+    // of the database or if a file could not be read
+    bool next();
+    bool hasError();
+
+    // position of the current game in the database, as for getGameAt()
+    int index();
+    IndexEntry* entry();
+    // inserts the headers of the current game, returns the result
+    int readHeaders(QMap<QString, QString> *headers);
+
+    // encoded record of the current game (without the length
+    // prefix). 0 if the cursor only reads headers
+    const uint8_t* record();
+    size_t recordSize();
+    // the record including its length prefix, i.e. as
+    // it is stored in the .dcg file
+    const uint8_t* rawRecord();
+    size_t rawRecordSize();
+
+    // appends the main line moves in .dcg encoding, at most maxMoves
+    // unless it is negative, cf. DcgDecoder::decodeMainline()
+    int readMainline(QVector<quint16> *moves, int maxMoves = -1);
+    // FEN of the start position, empty for the initial position
+    QByteArray readFen();
+    // decode the current game including its headers
+    FlatGame* readGame(FlatGame *g);
+    Game* readGame(Game *g);
+
+private:
+    Database *db;
+    bool headersOnly;
+    bool error;
+    QFile *indexFile;
+    QFile *gamesFile;
+    QByteArray *indexBuffer;
+    int indexPos;
+    // window of the .dcg file that is currently in gamesBuffer
+    QByteArray *gamesBuffer;
+    qint64 gamesBufferStart;
+    IndexEntry *current;
+    int currentIndex;
+    const uint8_t *currentRecord;
+    size_t currentRecordSize;
+    size_t currentPrefixSize;
+    DcgDecoder *decoder;
+    bool fillIndex();
+    size_t availableGames(qint64 offset, size_t n);
+    bool loadRecord();
+};
+
+}
+
+#endif // GAMECURSOR_H
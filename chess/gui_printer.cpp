@@ -32,6 +32,12 @@
 
 namespace chess {
 
+GuiFragment::GuiFragment()
+{
+    this->revision = -1;
+    this->generation = 0;
+}
+
 GuiPrinter::GuiPrinter()
 {
     this->pgn = QString("");
@@ -39,14 +45,21 @@ GuiPrinter::GuiPrinter()
     this->variationDepth = 0;
     this->forceMoveNumber = true;
     this->newLine = false;
+    this->generation = 0;
+    this->visited = 0;
+    this->lastSize = 0;
 }
 
 void GuiPrinter::reset() {
+    // the html is usually about as long as last time
     this->pgn = QString("");
+    this->pgn.reserve(this->lastSize + 256);
     this->currentLine = QString("");
     this->variationDepth = 0;
     this->forceMoveNumber = false;
     this->newLine = false;
+    this->generation++;
+    this->visited = 0;
 }
 
 void GuiPrinter::writeToken(const QString &token) {
@@ -70,94 +83,108 @@ QString GuiPrinter::printGame(Game *g) {
     this->printResult(g->getResult());
     this->pgn.append(this->currentLine);
 
+    // forget nodes that are no longer part of the game
+    if(this->cache.size() > this->visited) {
+        QMutableHashIterator<int, GuiFragment> i(this->cache);
+        while(i.hasNext()) {
+            i.next();
+            if(i.value().generation != this->generation) {
+                i.remove();
+            }
+        }
+    }
+    this->lastSize = this->pgn.size();
+
     return pgn;
 
 }
 
-void GuiPrinter::printMove(GameNode *node) { //int nodeId, Board *b, Move *m) {
-        int nodeId = node->getId();
-        Board *b = node->getParent()->getBoard();
-        assert(b != 0);
-        QString s_nodeId = QString::number(nodeId);
-        this->writeToken("<a name=\"");
-        this->writeToken(s_nodeId);
-        this->writeToken("\" href=\"#");
-        this->writeToken(s_nodeId);
-        this->writeToken("\">");
-
-        if(b->turn == WHITE) {
-            QString tkn = QString::number(b->fullmove_number);
-            tkn.append(QString(". "));
-            this->writeToken(tkn);
-        }
-        else if(this->forceMoveNumber) {
-            QString tkn = QString::number(b->fullmove_number);
-            tkn.append(QString("... "));
-            this->writeToken(tkn);
-        }
-        this->writeToken(node->getSan());
-        this->writeToken("</a> ");
+GuiFragment* GuiPrinter::fragment(GameNode *node) {
+    int nodeId = node->getId();
+    GuiFragment *f = &this->cache[nodeId];
+    f->generation = this->generation;
+    this->visited++;
+    if(f->revision == node->getRevision()) {
+        return f;
+    }
+    Board *b = node->getParent()->getBoard();
+    assert(b != 0);
+    QString s_nodeId = QString::number(nodeId);
+    QString anchor = QString("<a name=\"").append(s_nodeId).append("\" href=\"#")
+            .append(s_nodeId).append("\">");
+    QString tail = node->getSan().append("</a> ");
+    const QList<int> *nags = node->getNags();
+    for(int j=0;j<nags->count();j++) {
+        tail.append(this->nagString(nags->at(j)));
+    }
+    QString number = QString::number(b->fullmove_number);
+    if(b->turn == WHITE) {
+        f->move = anchor + number + QString(". ") + tail;
+        f->forcedMove = f->move;
+    } else {
+        f->move = anchor + tail;
+        f->forcedMove = anchor + number + QString("... ") + tail;
+    }
+    if(!node->getComment().isEmpty()) {
+        f->comment = this->commentString(node->getComment());
+    } else {
+        f->comment = QString();
+    }
+    f->revision = node->getRevision();
+    return f;
+}
 
+GuiFragment* GuiPrinter::printMove(GameNode *node) {
+    // move and nags, the comment is left to the caller
+    GuiFragment *f = this->fragment(node);
+    if(this->forceMoveNumber) {
+        this->writeToken(f->forcedMove);
+    } else {
+        this->writeToken(f->move);
+    }
     this->forceMoveNumber = false;
     this->newLine = false;
+    return f;
 }
 
-void GuiPrinter::printNag(int nag) {
+QString GuiPrinter::nagString(int nag) {
     switch(nag) {
     case NAG_GOOD_MOVE:
-        this->writeToken("! ");
-        break;
+        return QString("! ");
     case NAG_MISTAKE:
-        this->writeToken("? ");
-        break;
+        return QString("? ");
     case NAG_BRILLIANT_MOVE:
-        this->writeToken("!! ");
-        break;
+        return QString("!! ");
     case NAG_BLUNDER:
-        this->writeToken("?? ");
-        break;
+        return QString("?? ");
     case NAG_SPECULATIVE_MOVE:
-        this->writeToken("!? ");
-        break;
+        return QString("!? ");
     case NAG_DUBIOUS_MOVE:
-        this->writeToken("?! ");
-        break;
+        return QString("?! ");
     case NAG_FORCED_MOVE:
-        this->writeToken("□ ");
-        break;
+        return QString("□ ");
     case NAG_DRAWISH_POSITION:
-        this->writeToken("= ");
-        break;
+        return QString("= ");
     case NAG_UNCLEAR_POSITION:
-        this->writeToken("∞ ");
-        break;
+        return QString("∞ ");
     case NAG_WHITE_MODERATE_ADVANTAGE:
-        this->writeToken("+/= ");
-        break;
+        return QString("+/= ");
     case NAG_BLACK_MODERATE_ADVANTAGE:
-        this->writeToken("-/= ");
-        break;
+        return QString("-/= ");
     case NAG_WHITE_DECISIVE_ADVANTAGE:
-        this->writeToken("+- ");
-        break;
+        return QString("+- ");
     case NAG_BLACK_DECISIVE_ADVANTAGE:
-        this->writeToken("-+ ");
-        break;
+        return QString("-+ ");
     case NAG_WHITE_ZUGZWANG:
-        this->writeToken("⨀	 ");
-        break;
+        return QString("⨀	 ");
     case NAG_BLACK_ZUGZWANG:
-        this->writeToken("⨀	 ");
-        break;
+        return QString("⨀	 ");
     case NAG_WHITE_HAS_ATTACK:
-        this->writeToken("↑ ");
-        break;
+        return QString("↑ ");
     case NAG_BLACK_HAS_ATTACK:
-        this->writeToken("↑ ");
-        break;
+        return QString("↑ ");
     default:
-        QString tkn = QString("$").append(QString::number(nag)).append(" ");
-        this->writeToken(tkn);
+        return QString("$").append(QString::number(nag)).append(" ");
     }
 }
 
@@ -212,10 +239,13 @@ void GuiPrinter::endVariation() {
     }
 }
 
-void GuiPrinter::printComment(const QString &comment) {
+QString GuiPrinter::commentString(const QString &comment) {
     QString temp_c = QString(comment);
-    QString write = QString("{ ").append(temp_c.replace("}","").trimmed()).append(" } ");
-    this->writeToken(write);
+    return QString("{ ").append(temp_c.replace("}","").trimmed()).append(" } ");
+}
+
+void GuiPrinter::printComment(const QString &comment) {
+    this->writeToken(this->commentString(comment));
     //this->forceMoveNumber = false;
 }
 
@@ -230,21 +260,13 @@ void GuiPrinter::printGameContent(GameNode* g, bool onMainLine) {
             this->writeToken("<b>");
         }
         GameNode* main_variation = g->getVariation(0);
-        this->printMove(main_variation);
-        // write nags
-        QList<int> *nags = main_variation->getNags();
-        for(int j=0;j<nags->count();j++) {
-            int n = nags->at(j);
-            this->printNag(n);
-        }
+        GuiFragment *f = this->printMove(main_variation);
 
         if(onMainLine) {
             this->writeToken("</b>");
         }
         // write comments
-        if(!main_variation->getComment().isEmpty()) {
-            this->printComment(main_variation->getComment());
-        }
+        this->writeToken(f->comment);
     }
     // now handle all variations (sidelines)
     for(int i=1;i<cntVar;i++) {
@@ -252,19 +274,9 @@ void GuiPrinter::printGameContent(GameNode* g, bool onMainLine) {
         GameNode *var_i = g->getVariation(i);
 
         this->beginVariation();
-        this->printMove(var_i);
-
-        // next print nags
-
-        QList<int> *nags = var_i->getNags();
-        for(int j=0;j<nags->count();j++) {
-            int n = nags->at(j);
-            this->printNag(n);
-        }
-        // finally print comments
-        if(!var_i->getComment().isEmpty()) {
-            this->printComment(var_i->getComment());
-        }
+        GuiFragment *f = this->printMove(var_i);
+        // then comments
+        this->writeToken(f->comment);
         // recursive call for all childs
         this->printGameContent(var_i, false);
         // print variation end
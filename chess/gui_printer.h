@@ -21,9 +21,28 @@
 #ifndef GUI_PRINTER_H
 #define GUI_PRINTER_H
 #include "game.h"
+#include <QHash>
 
 namespace chess {
 
+/**
+ * @brief GuiFragment html of the move of one node, cached by GuiPrinter
+ *                    until the node changes
+ */
+struct GuiFragment {
+    GuiFragment();
+    // GameNode::getRevision() when the html was created
+    int revision;
+    // printGame() call that last used the fragment
+    int generation;
+    // anchor, move number if white moved, san and nags
+    QString move;
+    // same with the move number also for black
+    QString forcedMove;
+    // empty if the node has no comment
+    QString comment;
+};
+
 class GuiPrinter
 {
 public:
@@ -38,7 +57,10 @@ public:
 
     /**
      * @brief printGame returns a formatted for displaying in QTextBrowser
-     *                  of the supplied game
+     *                  of the supplied game. The html of every move is cached,
+     *                  so printing the game again after an edit only creates
+     *                  it anew for nodes that changed (cf. GameNode::getRevision()),
+     *                  and otherwise just joins the cached parts.
      * @param g pointer to a Game
      * @return text string of game using san notation.
      */
@@ -50,14 +72,20 @@ private:
     bool forceMoveNumber;
     QString pgn;
     QString currentLine;
+    QHash<int, GuiFragment> cache;
+    int generation;
+    int visited;
+    int lastSize;
     void reset();
     void flushCurrentLine();
     void writeToken(const QString &token);
     void writeLine(const QString &token);
     void printGameContent(GameNode *g, bool onMainLine);
-    void printMove(GameNode *g);
+    GuiFragment* fragment(GameNode *node);
+    GuiFragment* printMove(GameNode *g);
     void printComment(const QString &comment);
-    void printNag(int nag);
+    QString commentString(const QString &comment);
+    QString nagString(int nag);
     void printResult(int result);
     void beginVariation();
     void endVariation();
@@ -0,0 +1,155 @@
+#include "importjournal.h"
+#include "byteutil.h"
+#include <QByteArray>
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace chess {
+
+const char JOURNAL_CHECKPOINT = 0x01;
+// marker, pgn offset, index length, games length
+const int JOURNAL_CHECKPOINT_SIZE = 25;
+
+ImportJournal::ImportJournal(const QString &filename)
+{
+    this->filename = filename;
+    this->checkpointed = false;
+    this->pgnOffset = 0;
+    this->indexLength = 0;
+    this->gamesLength = 0;
+}
+
+bool ImportJournal::begin(const QString &pgnfile, const QStringList &files) {
+    this->pgnFile = pgnfile;
+    this->startLengths.clear();
+    this->checkpointed = false;
+    QByteArray header = QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x6a");
+    header.append(char(0x00));
+    for(int i=0;i<files.size();i++) {
+        quint64 length = quint64(QFile(files.at(i)).size());
+        this->startLengths.append(length);
+        ByteUtil::append_as_uint64(&header, length);
+    }
+    QByteArray name = pgnfile.toUtf8();
+    ByteUtil::append_as_uint32(&header, quint32(name.size()));
+    header.append(name);
+    QFile journal(this->filename);
+    if(!journal.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+    bool ok = journal.write(header) == header.size() && ImportJournal::sync(&journal);
+    journal.close();
+    return ok;
+}
+
+bool ImportJournal::checkpoint(quint64 pgnOffset, quint64 indexLength, quint64 gamesLength) {
+    QByteArray record;
+    record.append(JOURNAL_CHECKPOINT);
+    ByteUtil::append_as_uint64(&record, pgnOffset);
+    ByteUtil::append_as_uint64(&record, indexLength);
+    ByteUtil::append_as_uint64(&record, gamesLength);
+    QFile journal(this->filename);
+    if(!journal.open(QFile::Append)) {
+        return false;
+    }
+    bool ok = journal.write(record) == record.size() && ImportJournal::sync(&journal);
+    journal.close();
+    if(ok) {
+        this->checkpointed = true;
+        this->pgnOffset = pgnOffset;
+        this->indexLength = indexLength;
+        this->gamesLength = gamesLength;
+    }
+    return ok;
+}
+
+void ImportJournal::finish() {
+    QFile::remove(this->filename);
+}
+
+bool ImportJournal::load() {
+    QFile journal(this->filename);
+    if(!journal.open(QFile::ReadOnly)) {
+        return false;
+    }
+    QByteArray data = journal.readAll();
+    journal.close();
+    const uint8_t *d = reinterpret_cast<const uint8_t*>(data.constData());
+    // magic, version, five lengths and the length of the pgn name
+    int pos = 11 + 5 * 8 + 4;
+    if(data.size() < pos || data.left(10) != QByteArrayLiteral("\x53\x69\x6d\x70\x6c\x65\x43\x44\x62\x6a")) {
+        return false;
+    }
+    this->startLengths.clear();
+    for(int i=0;i<5;i++) {
+        this->startLengths.append(ByteUtil::read_as_uint64(d + 11 + i * 8));
+    }
+    int nameLength = int(ByteUtil::read_as_uint32(d + 51));
+    if(data.size() < pos + nameLength) {
+        return false;
+    }
+    this->pgnFile = QString::fromUtf8(data.constData() + pos, nameLength);
+    pos += nameLength;
+    // the last checkpoint that was written completely counts
+    this->checkpointed = false;
+    while(pos + JOURNAL_CHECKPOINT_SIZE <= data.size() && data.at(pos) == JOURNAL_CHECKPOINT) {
+        this->checkpointed = true;
+        this->pgnOffset = ByteUtil::read_as_uint64(d + pos + 1);
+        this->indexLength = ByteUtil::read_as_uint64(d + pos + 9);
+        this->gamesLength = ByteUtil::read_as_uint64(d + pos + 17);
+        pos += JOURNAL_CHECKPOINT_SIZE;
+    }
+    return true;
+}
+
+bool ImportJournal::rollback(const QStringList &files) {
+    bool ok = true;
+    for(int i=0;i<files.size() && i<this->startLengths.size();i++) {
+        quint64 length = this->startLengths.at(i);
+        // dictionaries are complete once there is a checkpoint
+        if(this->checkpointed && i >= 3) {
+            length = i == 3 ? this->indexLength : this->gamesLength;
+        } else if(this->checkpointed) {
+            continue;
+        }
+        QFile f(files.at(i));
+        if(!f.exists() || quint64(f.size()) <= length) {
+            continue;
+        }
+        if(f.open(QFile::ReadWrite)) {
+            ok = f.resize(qint64(length)) && ImportJournal::sync(&f) && ok;
+            f.close();
+        } else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+QString ImportJournal::getPgnFile() {
+    return this->pgnFile;
+}
+
+bool ImportJournal::hasCheckpoint() {
+    return this->checkpointed;
+}
+
+quint64 ImportJournal::getPgnOffset() {
+    return this->pgnOffset;
+}
+
+bool ImportJournal::sync(QFile *f) {
+    if(!f->flush()) {
+        return false;
+    }
+#ifdef Q_OS_WIN
+    return _commit(f->handle()) == 0;
+#else
+    return fsync(f->handle()) == 0;
+#endif
+}
+
+}
@@ -0,0 +1,60 @@
+#ifndef IMPORTJOURNAL_H
+#define IMPORTJOURNAL_H
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QFile>
+
+namespace chess {
+
+// write-ahead journal of an import (*.dcj next to the database files).
+// begin() records the length of all database files before anything is
+// appended. whenever the importer has made a group of games durable, it
+// appends a checkpoint with the position in the PGN file and the lengths
+// of the .dci and .dcg up to which they are consistent. after a crash,
+// the files are truncated back to the last checkpoint (or to their
+// original length if there is none) and the import continues from there.
+// each step is synced to disk before the next one relies on it
+class ImportJournal
+{
+public:
+    ImportJournal(const QString &filename);
+
+    // starts a journal for importing pgnfile. files are the name, site,
+    // event, index and games file, in that order. returns false if the
+    // journal can't be written; nothing may be appended then
+    bool begin(const QString &pgnfile, const QStringList &files);
+    // records that everything up to the given lengths is on disk and
+    // the import continues at pgnOffset
+    bool checkpoint(quint64 pgnOffset, quint64 indexLength, quint64 gamesLength);
+    // the import is complete, removes the journal
+    void finish();
+
+    // reads the journal of an interrupted import. false if there is
+    // none, or if it was cut off before anything was appended
+    bool load();
+    // truncates the files given to begin() back to the last checkpoint,
+    // or to their length before the import if there is no checkpoint
+    bool rollback(const QStringList &files);
+
+    QString getPgnFile();
+    bool hasCheckpoint();
+    quint64 getPgnOffset();
+
+    // flushes f and waits until its content is on disk
+    static bool sync(QFile *f);
+
+private:
+    QString filename;
+    QString pgnFile;
+    QList<quint64> startLengths;
+    bool checkpointed;
+    quint64 pgnOffset;
+    quint64 indexLength;
+    quint64 gamesLength;
+};
+
+}
+
+#endif // IMPORTJOURNAL_H
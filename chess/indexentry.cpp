@@ -1,11 +1,54 @@
 #include "indexentry.h"
+#include "byteutil.h"
+#include "database.h"
+#include <string.h>
 
 namespace chess {
 
 IndexEntry::IndexEntry()
 {
+    memset(this->eco, 0, sizeof this->eco);
+}
 
+void IndexEntry::read(const uint8_t *data) {
+    // layout as written by Database::importPgnAppendGamesIndices()
+    this->deleted = data[0] == GAME_DELETED;
+    this->gameOffset = ByteUtil::read_as_uint64(data + 1);
+    this->whiteOffset = ByteUtil::read_as_uint32(data + 9);
+    this->blackOffset = ByteUtil::read_as_uint32(data + 13);
+    this->round = ByteUtil::read_as_uint16(data + 17);
+    this->siteRef = ByteUtil::read_as_uint32(data + 19);
+    this->eventRef = ByteUtil::read_as_uint32(data + 23);
+    this->eloWhite = ByteUtil::read_as_uint16(data + 27);
+    this->eloBlack = ByteUtil::read_as_uint16(data + 29);
+    this->result = data[31];
+    memcpy(this->eco, data + 32, 3);
+    this->eco[3] = 0;
+    this->year = ByteUtil::read_as_uint16(data + 35);
+    this->month = data[37];
+    this->day = data[38];
 }
 
+void IndexEntry::write(QByteArray *out) {
+    ByteUtil::append_as_uint8(out, this->deleted ? GAME_DELETED : GAME_NOT_DELETED);
+    ByteUtil::append_as_uint64(out, this->gameOffset);
+    ByteUtil::append_as_uint32(out, this->whiteOffset);
+    ByteUtil::append_as_uint32(out, this->blackOffset);
+    ByteUtil::append_as_uint16(out, this->round);
+    ByteUtil::append_as_uint32(out, this->siteRef);
+    ByteUtil::append_as_uint32(out, this->eventRef);
+    ByteUtil::append_as_uint16(out, this->eloWhite);
+    ByteUtil::append_as_uint16(out, this->eloBlack);
+    ByteUtil::append_as_uint8(out, this->result);
+    // eco is padded with zeros, as for games without one
+    char eco[3] = { 0, 0, 0 };
+    for(int i=0;i<3 && this->eco[i] != 0;i++) {
+        eco[i] = this->eco[i];
+    }
+    out->append(eco, 3);
+    ByteUtil::append_as_uint16(out, this->year);
+    ByteUtil::append_as_uint8(out, this->month);
+    ByteUtil::append_as_uint8(out, this->day);
 }
 
+}
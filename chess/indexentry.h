@@ -5,10 +5,17 @@
 
 namespace chess {
 
+// size of one entry in the .dci file
+const int INDEX_ENTRY_SIZE = 39;
+
 class IndexEntry
 {
 public:
     IndexEntry();
+    // fills the entry from INDEX_ENTRY_SIZE bytes of a .dci file
+    void read(const uint8_t *data);
+    // appends the entry in the same layout to out
+    void write(QByteArray *out);
     quint64 gameOffset;
     quint8 deleted;
     quint32 whiteOffset;
@@ -19,7 +26,8 @@ public:
     quint16 eloWhite;
     quint16 eloBlack;
     quint8 result;
-    char* eco;
+    // three characters, zero terminated. all zero if there is none
+    char eco[sizeof "A00"];
     quint16 year;
     quint8 month;
     quint8 day;
@@ -26,19 +26,9 @@
 namespace chess {
 
 Move::Move(uint8_t from, uint8_t to) {
-
-    // create ascii (latin1) code numbers from
-    // uint8_t board pos numbers
-    QChar col_from = QChar((from % 10) + 96);
-    QChar row_from = QChar((from / 10) + 47);
-
-    QChar col_to = QChar((to % 10) + 96);
-    QChar row_to = QChar((to / 10) + 47);
-
     this->from = from;
     this->to = to;
     this->promotion_piece = 0;
-    this->uci_string = QString(col_from) + row_from + col_to + row_to;
     this->is_null = false;
 }
 
@@ -49,43 +39,18 @@ Move::Move() {
     this->from = 0x00;
     this->to = 0x00;
     this->promotion_piece = 0;
-    this->uci_string = "0000";
     this->is_null = true;
 }
 
 Move::Move(uint8_t from, uint8_t to, uint8_t promotion_piece) {
-    QChar col_from = QChar((from % 10) + 96);
-    QChar row_from = QChar((from / 10) + 47);
-
-    QChar col_to = QChar((to % 10) + 96);
-    QChar row_to = QChar((to / 10) + 47);
-
-    QChar prom_piece;
-    if(promotion_piece == KNIGHT) {
-        prom_piece = QChar('N');
-    } else if (promotion_piece == BISHOP) {
-        prom_piece = QChar('B');
-    } else if (promotion_piece == ROOK) {
-        prom_piece = QChar('R');
-    } else if (promotion_piece == QUEEN) {
-        prom_piece = QChar('Q');
-    } else {
-        prom_piece = QChar(' ');
-    }
     this->from = from;
     this->to = to;
     this->promotion_piece = promotion_piece;
-    if(prom_piece == QChar(' ')) {
-        this->uci_string = QString(col_from) + row_from + col_to + row_to;
-    } else {
-        this->uci_string = QString(col_from) + row_from + col_to + row_to + prom_piece;
-    }
     this->is_null = false;
 }
 
 Move::Move(QString uci) {
     assert((uci.size()==4) || (uci.size()==5));
-    this->uci_string = uci;
     QString up = uci.toUpper();
     uint8_t from_col = this->alpha_to_pos(up.at(0));
     // -49 for ascii(1) -> int 0, *10 + 20 is to get board coord
@@ -120,7 +85,6 @@ QString Move::uci() {
     if(this->is_null) {
         return "0000";
     } else {
-        //return this->uci_string;
         QChar col_from = QChar((this->from % 10) + 96);
         QChar row_from = QChar((this->from / 10) + 47);
 
@@ -155,16 +119,6 @@ QPoint Move::toAsXY() {
     return QPoint(col_to, row_to);
 }
 
-// create deep copy
-Move::Move(const Move& m) {
-    this->from = m.from;
-    this->to = m.to;
-    this->promotion_piece = m.promotion_piece;
-    this->is_null = m.is_null;
-    this->uci_string = this->uci(); // QString::fromUtf16(m.uci_string.utf16());
-}
-
-
 uint8_t Move::alpha_to_pos(QChar alpha) {
     if(alpha == QChar('A')) {
         return 1;
@@ -212,7 +166,21 @@ bool Move::operator!=(const Move &other) const {
  */
 std::ostream& operator<<(std::ostream &strm, const Move &m) {
 
-    return strm << m.uci_string.toStdString();
+    if(m.is_null) {
+        return strm << "0000";
+    }
+    strm << char((m.from % 10) + 96) << char((m.from / 10) + 47)
+         << char((m.to % 10) + 96) << char((m.to / 10) + 47);
+    if(m.promotion_piece == KNIGHT) {
+        strm << 'N';
+    } else if(m.promotion_piece == BISHOP) {
+        strm << 'B';
+    } else if(m.promotion_piece == ROOK) {
+        strm << 'R';
+    } else if(m.promotion_piece == QUEEN) {
+        strm << 'Q';
+    }
+    return strm;
 
 }
 
@@ -46,7 +46,6 @@ public:
     uint8_t from;
     uint8_t to;
     uint8_t promotion_piece;
-    QString uci_string;
     bool is_null;
 
     /**
@@ -92,12 +91,6 @@ public:
      */
     Move(QString uci);
 
-    /**
-     * @brief Move creates a deep copy of supplied move
-     * @param m the move to copy
-     */
-    Move(const Move& m);
-
     /**
      * @brief uci get uci string (e.g. g1f3, d7d8Q etc.) of current move
      * @return uci string
@@ -132,4 +125,9 @@ private:
 };
 
 }
+
+// moves are plain values, so that lists of moves can keep them
+// in place instead of allocating each one on its own
+Q_DECLARE_TYPEINFO(chess::Move, Q_MOVABLE_TYPE);
+
 #endif // MOVE_H
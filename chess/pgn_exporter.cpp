@@ -0,0 +1,142 @@
+#include "pgn_exporter.h"
+#include "chess/pgn_printer.h"
+#include "chess/flat_game.h"
+#include <QFile>
+#include <QThread>
+#include <QThreadPool>
+#include <QMutexLocker>
+#include <iostream>
+
+namespace chess {
+
+PgnExporter::PgnExporter(Database *db)
+{
+    this->db = db;
+    this->first = 0;
+    this->last = -1;
+    this->threads = QThread::idealThreadCount();
+}
+
+void PgnExporter::setRange(int first, int last) {
+    this->first = first > 0 ? first : 0;
+    this->last = last;
+}
+
+void PgnExporter::setPlayer(const QString &name) {
+    this->player = name;
+}
+
+void PgnExporter::setEvent(const QString &name) {
+    this->event = name;
+}
+
+void PgnExporter::setThreads(int n) {
+    this->threads = n > 0 ? n : 1;
+}
+
+bool PgnExporter::matches(IndexEntry *ie) {
+    if(ie->deleted) {
+        return false;
+    }
+    if(!this->player.isEmpty() && this->db->getName(ie->whiteOffset) != this->player
+            && this->db->getName(ie->blackOffset) != this->player) {
+        return false;
+    }
+    if(!this->event.isEmpty() && this->db->getEvent(ie->eventRef) != this->event) {
+        return false;
+    }
+    return true;
+}
+
+int PgnExporter::exportGames(const QString &filename) {
+    QFile out(filename);
+    if(!out.open(QFile::WriteOnly | QFile::Truncate)) {
+        std::cerr << "Error: can't open PGN file for writing." << std::endl;
+        return -1;
+    }
+    int end = this->db->countGames();
+    if(this->last >= 0 && this->last < end) {
+        end = this->last + 1;
+    }
+    int next = this->first;
+    QThreadPool pool;
+    pool.setMaxThreadCount(this->threads);
+    // chunks handed to the pool and not written yet, in database order
+    QList<ExportChunk*> pending;
+    int written = 0;
+    bool ok = true;
+    while(ok) {
+        // keep all threads busy with a few chunks to spare
+        while(next < end && pending.size() < this->threads * 4) {
+            ExportChunk *chunk = new ExportChunk();
+            chunk->games = 0;
+            chunk->done = false;
+            while(next < end && chunk->ids.size() < EXPORT_CHUNK_GAMES) {
+                if(this->matches(this->db->getIndexEntry(next))) {
+                    chunk->ids.append(next);
+                }
+                next++;
+            }
+            if(chunk->ids.isEmpty()) {
+                delete chunk;
+                continue;
+            }
+            pending.append(chunk);
+            pool.start(new ExportTask(this, chunk));
+        }
+        if(pending.isEmpty()) {
+            break;
+        }
+        ExportChunk *chunk = pending.takeFirst();
+        {
+            QMutexLocker lock(&this->mutex);
+            while(!chunk->done) {
+                this->chunkDone.wait(&this->mutex);
+            }
+        }
+        ok = out.write(chunk->text) == chunk->text.size();
+        written += chunk->games;
+        delete chunk;
+    }
+    pool.waitForDone();
+    for(int i=0;i<pending.size();i++) {
+        delete pending.at(i);
+    }
+    out.close();
+    if(!ok) {
+        std::cerr << "Error: can't write PGN file." << std::endl;
+        return -1;
+    }
+    return written;
+}
+
+void PgnExporter::convert(ExportChunk *chunk) {
+    FlatGame game;
+    PgnPrinter printer;
+    for(int i=0;i<chunk->ids.size();i++) {
+        try {
+            this->db->getFlatGameAt(chunk->ids.at(i), &game);
+        } catch(std::invalid_argument a) {
+            std::cerr << "Error: can't decode game " << chunk->ids.at(i) << ": " << a.what() << std::endl;
+            continue;
+        }
+        printer.printGame(&game, &chunk->text);
+        chunk->text.append('\n');
+        chunk->games++;
+    }
+    QMutexLocker lock(&this->mutex);
+    chunk->done = true;
+    this->chunkDone.wakeAll();
+}
+
+ExportTask::ExportTask(PgnExporter *exporter, ExportChunk *chunk)
+{
+    this->exporter = exporter;
+    this->chunk = chunk;
+}
+
+void ExportTask::run() {
+    this->exporter->convert(this->chunk);
+}
+
+}
@@ -0,0 +1,83 @@
+#ifndef PGN_EXPORTER_H
+#define PGN_EXPORTER_H
+
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QRunnable>
+#include "chess/database.h"
+#include "chess/indexentry.h"
+
+namespace chess {
+
+// number of games a worker converts in one go
+const int EXPORT_CHUNK_GAMES = 512;
+
+// consecutive games of an export and their PGN text
+struct ExportChunk {
+    QVector<int> ids;
+    QByteArray text;
+    int games;
+    bool done;
+};
+
+// converts the games of a database back to PGN. the selected games are
+// split into chunks that are decoded and printed on a pool of threads,
+// each into a buffer of its own. the buffers are written to the output
+// file in the order of the database with one large write each. only a
+// few chunks per thread are in flight at once, so memory doesn't grow
+// with the size of the database. names, sites and events must have
+// been loaded into the database
+class PgnExporter
+{
+public:
+    PgnExporter(Database *db);
+
+    // only games first .. last (both inclusive) by their position
+    // in the database, as for getGameAt(). last < 0 for all after first
+    void setRange(int first, int last);
+    // only games where name has white or black
+    void setPlayer(const QString &name);
+    // only games of this event
+    void setEvent(const QString &name);
+    // number of worker threads, the number of cores by default
+    void setThreads(int n);
+
+    // writes all selected games that aren't deleted to filename. returns
+    // the number of games written, or -1 if the file can't be written
+    int exportGames(const QString &filename);
+
+    // prints the games of chunk into its text. called by the workers
+    void convert(ExportChunk *chunk);
+
+private:
+    Database *db;
+    int first;
+    int last;
+    QString player;
+    QString event;
+    int threads;
+    QMutex mutex;
+    // signalled whenever a chunk is done
+    QWaitCondition chunkDone;
+    bool matches(IndexEntry *ie);
+};
+
+// worker task that converts one chunk
+class ExportTask : public QRunnable
+{
+public:
+    ExportTask(PgnExporter *exporter, ExportChunk *chunk);
+    void run();
+
+private:
+    PgnExporter *exporter;
+    ExportChunk *chunk;
+};
+
+}
+
+#endif // PGN_EXPORTER_H
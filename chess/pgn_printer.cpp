@@ -22,7 +22,6 @@
 #include <QHashIterator>
 #include <iostream>
 #include <QFile>
-#include <QTextStream>
 #include <QDebug>
 #include "game.h"
 #include "pgn_printer.h"
@@ -31,49 +30,74 @@ namespace chess {
 
 PgnPrinter::PgnPrinter() {
     this->pgn = new QStringList();
-    this->currentLine = QString("");
+    this->out = 0;
+    this->lineStart = 0;
+    this->lineLength = 0;
     this->variationDepth = 0;
     this->forceMoveNumber = true;
 }
 
-void PgnPrinter::reset() {
-    this->pgn->clear();
-    this->currentLine = QString("");
+void PgnPrinter::reset(QByteArray *out) {
+    this->out = out;
+    this->lineStart = out->size();
+    this->lineLength = 0;
     this->variationDepth = 0;
     this->forceMoveNumber = false;
 }
 
+QStringList* PgnPrinter::toLines(const QByteArray &text) {
+    // the text ends with a newline, which doesn't start another line
+    pgn = new QStringList(QString::fromUtf8(text.constData(), text.size() - 1).split(QChar('\n')));
+    return pgn;
+}
+
 void PgnPrinter::flushCurrentLine() {
-    if(!this->currentLine.isEmpty()) {
-        QString line_copy = QString(this->currentLine);
-        this->pgn->append(line_copy.trimmed());
+    if(this->lineLength > 0) {
+        // tokens end with a blank, which is dropped at the end of a line
+        int end = this->out->size();
+        while(end > this->lineStart && (this->out->at(end-1) == ' ' || this->out->at(end-1) == '\t'
+                                        || this->out->at(end-1) == '\r' || this->out->at(end-1) == '\n')) {
+            end--;
+        }
+        this->out->resize(end);
+        this->out->append('\n');
+    }
+    this->lineStart = this->out->size();
+    this->lineLength = 0;
+}
+
+void PgnPrinter::writeToken(const char *token, int len) {
+    if(80 - this->lineLength < len) {
+        this->flushCurrentLine();
     }
-    this->currentLine = QString("");
+    this->out->append(token, len);
+    this->lineLength += len;
 }
 
 void PgnPrinter::writeToken(const QString &token) {
-    if(80 - this->currentLine.length() < token.length()) {
+    // lines are wrapped by characters, not by bytes
+    if(80 - this->lineLength < token.length()) {
         this->flushCurrentLine();
     }
-    this->currentLine.append(token);
+    this->out->append(token.toUtf8());
+    this->lineLength += token.length();
 }
 
 void PgnPrinter::writeLine(const QString &line) {
     this->flushCurrentLine();
-    this->pgn->append(line.trimmed());
+    this->out->append(line.trimmed().toUtf8());
+    this->out->append('\n');
+    this->lineStart = this->out->size();
 }
 
 void PgnPrinter::writeGame(Game *g, const QString &filename) {
 
-    QStringList* pgn = this->printGame(g);
+    QByteArray text;
+    this->printGame(g, &text);
     QFile fOut(filename);
     bool success = false;
     if(fOut.open(QFile::WriteOnly | QFile::Text)) {
-      QTextStream s(&fOut);
-      for (int i = 0; i < pgn->size(); ++i) {
-          s << pgn->at(i) << '\n';
-      }
-      success = true;
+      success = fOut.write(text) == text.size();
     } else {
       std::cerr << "error opening output file\n";
     }
@@ -83,49 +107,60 @@ void PgnPrinter::writeGame(Game *g, const QString &filename) {
     }
 }
 
-void PgnPrinter::printHeaders(QStringList *pgn, Game *g) {
-    QMap<QString, QString>* headers = g->headers;
-    QString tag = "[Event \"" + headers->value("Event") + "\"]";
-    pgn->append(tag);
-    tag = "[Site \"" + headers->value("Site") + "\"]";
-    pgn->append(tag);
-    tag = "[Date \"" + headers->value("Date") + "\"]";
-    pgn->append(tag);
-    tag = "[Round \"" + headers->value("Round") + "\"]";
-    pgn->append(tag);
-    tag = "[White \"" + headers->value("White") + "\"]";
-    pgn->append(tag);
-    tag = "[Black \"" + headers->value("Black") + "\"]";
-    pgn->append(tag);
-    tag = "[Result \"" + headers->value("Result") + "\"]";
-    pgn->append(tag);
+void PgnPrinter::printHeader(const char *tag, const QString &value) {
+    this->out->append('[');
+    this->out->append(tag);
+    this->out->append(" \"");
+    this->out->append(value.toUtf8());
+    this->out->append("\"]\n");
+}
+
+void PgnPrinter::printHeaders(QMap<QString, QString> *headers, Board *root) {
+    this->printHeader("Event", headers->value("Event"));
+    this->printHeader("Site", headers->value("Site"));
+    this->printHeader("Date", headers->value("Date"));
+    this->printHeader("Round", headers->value("Round"));
+    this->printHeader("White", headers->value("White"));
+    this->printHeader("Black", headers->value("Black"));
+    this->printHeader("Result", headers->value("Result"));
     QMapIterator<QString, QString> i(*(headers));
     while (i.hasNext()) {
         i.next();
         if(i.key() != "Event" && i.key() != "Site" && i.key() != "Date" && i.key() != "Round"
                 && i.key() != "White" && i.key() != "Black" && i.key() != "Result" )
         {
-            QString tag = "[" + i.key() + " \"" + i.value() + "\"]";
-            pgn->append(tag);
+            this->printHeader(i.key().toUtf8().constData(), i.value());
         }
     }
     // add fen string tag if root is not initial position
-    chess::Board* root = g->getRootNode()->getBoard();
     if(!root->is_initial_position()) {
-        QString tag = "[FEN \"" + root->fen() + "\"]";
-        pgn->append(tag);
+        char fen[FEN_MAX_LENGTH];
+        int len = root->fen(fen);
+        this->out->append("[FEN \"");
+        this->out->append(fen, len);
+        this->out->append("\"]\n");
     }
-
+    this->lineStart = this->out->size();
 }
 
 QStringList* PgnPrinter::printGame(Game *g) {
+    QByteArray text;
+    this->printGame(g, &text);
+    return this->toLines(text);
+}
 
-    this->reset();
+QStringList* PgnPrinter::printGame(FlatGame *g) {
+    QByteArray text;
+    this->printGame(g, &text);
+    return this->toLines(text);
+}
 
-    pgn = new QStringList();
+void PgnPrinter::printGame(Game *g, QByteArray *out) {
+
+    this->reset(out);
 
     // first print the headers
-    this->printHeaders(pgn, g);
+    this->printHeaders(g->headers, g->getRootNode()->getBoard());
 
     this->writeLine(QString(""));
     GameNode *root = g->getRootNode();
@@ -138,59 +173,122 @@ QStringList* PgnPrinter::printGame(Game *g) {
 
     this->printGameContent(root);
     this->printResult(g->getResult());
-    this->pgn->append(this->currentLine);
+    // the last line is kept as it is
+    this->out->append('\n');
+    this->out = 0;
+}
 
-    return pgn;
+void PgnPrinter::printGame(FlatGame *g, QByteArray *out) {
 
-}
+    this->reset(out);
+
+    this->printHeaders(g->headers, g->getRootBoard());
+
+    this->writeLine(QString(""));
 
-void PgnPrinter::printMove(Board *b, Move *m) {
-    if(b->turn == WHITE) {
-        QString tkn = QString::number(b->fullmove_number);
-        tkn.append(QString(". "));
-        this->writeToken(tkn);
+    if(g->hasComment(0)) {
+        this->printComment(g->getComment(0));
     }
-    else if(this->forceMoveNumber) {
-        QString tkn = QString::number(b->fullmove_number);
-        tkn.append(QString("... "));
-        this->writeToken(tkn);
+
+    BoardState start;
+    g->getRootBoard()->save_state(&start);
+    Board *b = new Board();
+    b->restore_state(start);
+    this->printGameContent(g, 0, b);
+    delete b;
+    this->printResult(g->getResult());
+    this->out->append('\n');
+    this->out = 0;
+}
+
+void PgnPrinter::printMoveNumber(Board *b) {
+    if(b->turn == WHITE || this->forceMoveNumber) {
+        char tkn[16];
+        int len = 0;
+        char digits[10];
+        int n = 0;
+        unsigned int number = b->fullmove_number;
+        do {
+            digits[n++] = char('0' + number % 10);
+            number /= 10;
+        } while(number > 0 && n < 10);
+        while(n > 0) {
+            tkn[len++] = digits[--n];
+        }
+        if(b->turn == WHITE) {
+            tkn[len++] = '.';
+        } else {
+            tkn[len++] = '.';
+            tkn[len++] = '.';
+            tkn[len++] = '.';
+        }
+        tkn[len++] = ' ';
+        this->writeToken(tkn, len);
     }
-    //qDebug() << "Move: " << m->uci_string;
-    //qDebug() << "san: " << b->san(*m);
-    this->writeToken((b->san(*m)).append(QString(" ")));
     this->forceMoveNumber = false;
 }
 
+void PgnPrinter::printMove(Board *b, GameNode *node) {
+    this->printMoveNumber(b);
+    QString san = node->getSan();
+    char tkn[SAN_MAX_LENGTH + 1];
+    int len = 0;
+    for(int i=0;i<san.size() && len<SAN_MAX_LENGTH;i++) {
+        tkn[len++] = san.at(i).toLatin1();
+    }
+    tkn[len++] = ' ';
+    this->writeToken(tkn, len);
+}
+
+void PgnPrinter::printMove(Board *b, const Move &m) {
+    // m is made on b, which is left in the position after it
+    this->printMoveNumber(b);
+    char tkn[SAN_MAX_LENGTH + 1];
+    int len = b->san_body(m, tkn);
+    b->make(m);
+    if(!m.is_null && b->is_check()) {
+        tkn[len++] = b->is_checkmate() ? '#' : '+';
+    }
+    tkn[len++] = ' ';
+    this->writeToken(tkn, len);
+}
+
 void PgnPrinter::printNag(int nag) {
-    QString tkn = QString("$").append(QString::number(nag)).append(" ");
-    this->writeToken(tkn);
+    char tkn[16];
+    int len = 0;
+    tkn[len++] = '$';
+    if(nag >= 100) {
+        tkn[len++] = char('0' + (nag / 100) % 10);
+    }
+    if(nag >= 10) {
+        tkn[len++] = char('0' + (nag / 10) % 10);
+    }
+    tkn[len++] = char('0' + nag % 10);
+    tkn[len++] = ' ';
+    this->writeToken(tkn, len);
 }
 
 void PgnPrinter::printResult(int result) {
-    QString res = "";
     if(result == RES_WHITE_WINS) {
-        res = QString("1-0");
+        this->writeToken("1-0 ", 4);
     } else if(result == RES_BLACK_WINS) {
-        res = QString("0-1");
+        this->writeToken("0-1 ", 4);
     } else if(result == RES_DRAW) {
-        res = QString("1/2-1/2");
+        this->writeToken("1/2-1/2 ", 8);
     } else {
-        res = QString("*");
+        this->writeToken("* ", 2);
     }
-    this->writeToken(res.append(" "));
 }
 
 void PgnPrinter::beginVariation() {
     this->variationDepth++;
-    QString tkn = QString("( ");
-    this->writeToken(tkn);
+    this->writeToken("( ", 2);
     this->forceMoveNumber = true;
 }
 
 void PgnPrinter::endVariation() {
     this->variationDepth--;
-    QString tkn = QString(") ");
-    this->writeToken(tkn);
+    this->writeToken(") ", 2);
     this->forceMoveNumber = true;
 }
 
@@ -211,10 +309,9 @@ void PgnPrinter::printGameContent(GameNode* g) {
     int cntVar = g->getVariations()->count();
     if(cntVar > 0) {
         GameNode* main_variation = g->getVariation(0);
-        Move *m = main_variation->getMove();
-        this->printMove(b,m);
+        this->printMove(b,main_variation);
         // write nags
-        QList<int> *nags = main_variation->getNags();
+        const QList<int> *nags = main_variation->getNags();
         for(int j=0;j<nags->count();j++) {
             int n = nags->at(j);
             this->printNag(n);
@@ -230,9 +327,9 @@ void PgnPrinter::printGameContent(GameNode* g) {
         // first create variation start marker, and print the move
         GameNode *var_i = g->getVariation(i);
         this->beginVariation();
-        this->printMove(b,var_i->getMove());
+        this->printMove(b,var_i);
         // next print nags
-        QList<int> *nags = var_i->getNags();
+        const QList<int> *nags = var_i->getNags();
         for(int j=0;j<nags->count();j++) {
             int n = nags->at(j);
             this->printNag(n);
@@ -256,5 +353,47 @@ void PgnPrinter::printGameContent(GameNode* g) {
     }
 }
 
+void PgnPrinter::printGameContent(FlatGame *g, int ply, Board *b) {
+
+    // b is the position after ply. the main line is followed in
+    // a loop, variations are printed recursively. printing a move
+    // makes it on b, so for each variation the main line move is
+    // unmade, and the variation is unmade again after printing it
+    int main = g->getFirstChild(ply);
+    while(main >= 0) {
+        Move m = g->getMove(main);
+        this->printMove(b, m);
+        const QList<int> *nags = g->getNags(main);
+        for(int j=0;nags != 0 && j<nags->count();j++) {
+            this->printNag(nags->at(j));
+        }
+        if(g->hasComment(main)) {
+            this->printComment(g->getComment(main));
+        }
+        int var_i = g->getNextSibling(main);
+        if(var_i >= 0) {
+            b->unmake();
+            int depth = b->make_depth();
+            for(; var_i >= 0; var_i = g->getNextSibling(var_i)) {
+                this->beginVariation();
+                this->printMove(b, g->getMove(var_i));
+                nags = g->getNags(var_i);
+                for(int j=0;nags != 0 && j<nags->count();j++) {
+                    this->printNag(nags->at(j));
+                }
+                if(g->hasComment(var_i)) {
+                    this->printComment(g->getComment(var_i));
+                }
+                this->printGameContent(g, var_i, b);
+                this->endVariation();
+                while(b->make_depth() > depth) {
+                    b->unmake();
+                }
+            }
+            b->make(m);
+        }
+        main = g->getFirstChild(main);
+    }
+}
 
 }
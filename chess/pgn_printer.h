@@ -22,6 +22,8 @@
 #define PGN_PRINTER_H
 
 #include "game.h"
+#include "flat_game.h"
+#include <QByteArray>
 
 namespace chess {
 
@@ -43,6 +45,35 @@ public:
      */
     QStringList* printGame(Game *g);
 
+    /**
+     * @brief printGame same as above for a game in flat representation.
+     *                  positions are obtained by replaying the moves on one board
+     * @param g game to print
+     * @return string list of lines of the generated PGN
+     */
+    QStringList* printGame(FlatGame *g);
+
+    /**
+     * @brief printGame prints the supplied game to PGN format and appends it
+     *                  UTF-8 encoded to out, every line terminated by a newline.
+     *                  lines are wrapped at 80 columns. the san of a move is
+     *                  taken from the san cache of its node
+     * @param g game to print
+     * @param out buffer to append to. reusing one buffer for many games
+     *            avoids allocations once it has grown large enough
+     */
+    void printGame(Game *g, QByteArray *out);
+
+    /**
+     * @brief printGame same as above for a game in flat representation. the
+     *                  moves are replayed on one board, and check and checkmate
+     *                  are tested on the position after each move instead of
+     *                  a copy of the board
+     * @param g game to print
+     * @param out buffer to append to
+     */
+    void printGame(FlatGame *g, QByteArray *out);
+
     /**
      * @brief writeGame prints the supplied game to PGN format and saves
      *                  the game as filename on disk. Throws
@@ -58,20 +89,29 @@ private:
     int variationDepth;
     bool forceMoveNumber;
     QStringList *pgn;
-    QString currentLine;
-    void reset();
+    // target of the current game, start of the current
+    // line in it and length of that line in characters
+    QByteArray *out;
+    int lineStart;
+    int lineLength;
+    void reset(QByteArray *out);
+    QStringList* toLines(const QByteArray &text);
     void flushCurrentLine();
+    void writeToken(const char *token, int len);
     void writeToken(const QString &token);
     void writeLine(const QString &token);
     void printGameContent(GameNode *g);
-    void printMove(Board *board, Move *m);
+    void printGameContent(FlatGame *g, int ply, Board *b);
+    void printMoveNumber(Board *board);
+    void printMove(Board *board, GameNode *node);
+    void printMove(Board *board, const Move &m);
     void printComment(const QString &comment);
     void printNag(int nag);
-    void printHeaders(QStringList *pgn, Game *g);
+    void printHeader(const char *tag, const QString &value);
+    void printHeaders(QMap<QString, QString> *headers, Board *root);
     void printResult(int result);
     void beginVariation();
     void endVariation();
-    void flushLine();
 
 };
 
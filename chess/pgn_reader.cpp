@@ -681,7 +681,7 @@ Game* PgnReader::readGame(QTextStream& in) {
                     Board *b = current->getBoard();
                     //qDebug() << "token: " << token;
                     m = new Move(b->parse_san(token));
-                    //qDebug() << "uci: " << m->uci_string;
+                    //qDebug() << "uci: " << m->uci();
                     //qDebug() << "san:" << b->san(*m);
                     //qDebug() << "--";
                     b_next = b->copy_and_apply(*m);
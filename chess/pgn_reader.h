@@ -75,6 +75,12 @@ struct HeaderOffset
     QMap<QString, QString>* headers;
 };
 
+/**
+ * @brief PgnReader parses PGN into games. It has no members, and the
+ *        regular expressions above are only used through const matches,
+ *        so games can be read on several threads at once, with one shared
+ *        or one reader per thread.
+ */
 class PgnReader
 {
 
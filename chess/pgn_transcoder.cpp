@@ -0,0 +1,230 @@
+#include "pgn_transcoder.h"
+#include "chess/pgn_reader.h"
+#include <QFile>
+#include <QTextCodec>
+#include <iostream>
+
+chess::PgnTranscoder::PgnTranscoder()
+{
+    this->encoder = new chess::DcgEncoder();
+    this->board = new chess::Board(true);
+    this->board->save_state(&this->initialPosition);
+    this->pendingNags = new QList<int>();
+}
+
+chess::PgnTranscoder::~PgnTranscoder()
+{
+    delete this->encoder;
+    delete this->board;
+    delete this->pendingNags;
+}
+
+void chess::PgnTranscoder::flushAnnotations() {
+    // the encoder never writes nags of the root, so neither do we
+    if(this->board->make_depth() > 0 && !this->pendingNags->isEmpty()) {
+        this->encoder->appendNags(this->pendingNags);
+    }
+    if(!this->pendingComment.isEmpty()) {
+        this->encoder->appendComment(this->pendingComment);
+    }
+    this->pendingNags->clear();
+    this->pendingComment.clear();
+}
+
+int chess::PgnTranscoder::transcodeGameFromFile(const QString &filename, const char* encoding,
+                                                qint64 offset, QByteArray *out) {
+
+    QFile file(filename);
+
+    if(!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        throw std::invalid_argument("unable to open file w/ supplied filename");
+    }
+    QTextStream in(&file);
+    QTextCodec *codec = QTextCodec::codecForName(encoding);
+    in.setCodec(codec);
+    if(offset != 0 && offset > 0) {
+        in.seek(offset);
+    }
+    int written = this->transcodeGame(in, out);
+    file.close();
+    return written;
+}
+
+const chess::EcoEntry* chess::PgnTranscoder::getEcoEntry() {
+    return this->eco.getEntry();
+}
+
+int chess::PgnTranscoder::transcodeGame(QTextStream &in, QByteArray *out) {
+
+    QString starting_fen = QString("");
+    this->varMoves.clear();
+    this->varDepths.clear();
+    this->eco.reset();
+    this->pendingNags->clear();
+    this->pendingComment.clear();
+
+    QString line = in.readLine();
+    while (!in.atEnd()) {
+        if(line.startsWith("%") || line.isEmpty()) {
+            line = in.readLine();
+            continue;
+        }
+        QRegularExpressionMatch match_t = TAG_REGEX.match(line);
+        if(match_t.hasMatch()) {
+            if(match_t.captured(1) == QString("FEN")) {
+                starting_fen = match_t.captured(2);
+            }
+        } else {
+            break;
+        }
+        line = in.readLine();
+    }
+    // set starting fen, if available
+    if(!starting_fen.isEmpty()) {
+        chess::Board b_fen(starting_fen);
+        if(!b_fen.is_consistent()) {
+            throw std::invalid_argument("starting fen position is not consistent");
+        }
+        BoardState s;
+        b_fen.save_state(&s);
+        this->board->restore_state(s);
+    } else {
+        this->board->restore_state(this->initialPosition);
+    }
+
+    int start = out->size();
+    this->encoder->beginGame(out, this->board);
+
+    // Get the next non-empty line.
+    while(line.trimmed() == QString("") && !line.isEmpty()) {
+        line = in.readLine();
+    }
+
+    try {
+        bool foundContent = false;
+        bool last_line = false;
+        while(!in.atEnd() || !last_line || !line.isEmpty()) {
+            if(in.atEnd()) {
+                last_line = true;
+            }
+            bool readNextLine = true;
+            if(line.trimmed().isEmpty() && foundContent) {
+                break;
+            }
+            QRegularExpressionMatchIterator i = MOVETEXT_REGEX.globalMatch(line);
+            while (i.hasNext()) {
+                QRegularExpressionMatch match = i.next();
+                QString token = match.captured(0);
+                if(token.startsWith("%")) {
+                    line = in.readLine();
+                    continue;
+                }
+                if(token.startsWith("{")) {
+                    line = token.remove(0,1);
+                    QStringList comment_lines;
+                    // get comments - possibly over multiple lines
+                    if(line.isEmpty()) {
+                        line = in.readLine();
+                    }
+                    while(!line.isEmpty() && !line.contains("}")) {
+                        comment_lines.append(line.trimmed());
+                        line = in.readLine();
+                    }
+                    int end_index = line.indexOf("}");
+                    if(end_index != -1) {
+                        QString comment_line = QString(line);
+                        comment_line.remove(end_index,line.length()-end_index);
+                        comment_lines.append(comment_line);
+                    }
+                    if(line.contains("}")) {
+                        end_index = line.indexOf("}");
+                        line = line.remove(0,end_index+1);
+                    } else {
+                        line = QString("");
+                    }
+                    this->pendingComment = comment_lines.join(QString("\n"));
+                    // if the line didn't end with }, we don't want to read the next line yet
+                    if(!line.trimmed().isEmpty()) {
+                        readNextLine = false;
+                    }
+                    break;
+                }
+                else if(token.startsWith("$")) {
+                    this->pendingNags->append(token.remove(0,1).toInt());
+                }
+                else if(token == QString("?")) {
+                    this->pendingNags->append(NAG_MISTAKE);
+                }
+                else if(token == QString("??")) {
+                    this->pendingNags->append(NAG_BLUNDER);
+                }
+                else if(token == QString("!")) {
+                    this->pendingNags->append(NAG_GOOD_MOVE);
+                }
+                else if(token == QString("!!")) {
+                    this->pendingNags->append(NAG_BRILLIANT_MOVE);
+                }
+                else if(token == QString("!?")) {
+                    this->pendingNags->append(NAG_SPECULATIVE_MOVE);
+                }
+                else if(token == QString("?!")) {
+                    this->pendingNags->append(NAG_DUBIOUS_MOVE);
+                }
+                else if(token == QString("(")) {
+                    // remember the current node, and continue
+                    // from the position before its move
+                    if(this->board->make_depth() < 1) {
+                        throw std::invalid_argument("variation starts before first move");
+                    }
+                    this->flushAnnotations();
+                    this->varMoves.append(this->board->unmake());
+                    this->varDepths.append(this->board->make_depth());
+                    this->encoder->appendStartTag();
+                }
+                else if(token == QString(")")) {
+                    // always leave root
+                    if(!this->varMoves.isEmpty()) {
+                        this->flushAnnotations();
+                        int depth = this->varDepths.takeLast();
+                        while(this->board->make_depth() > depth) {
+                            this->board->unmake();
+                        }
+                        this->board->make(this->varMoves.takeLast());
+                        this->encoder->appendEndTag();
+                    }
+                }
+                else if(token == QString("1-0") || token == QString("0-1") ||
+                        token == QString("1/2-1/2") || token == QString("*")) {
+                    foundContent = true;
+                }
+                else { // this should be a san token
+                    foundContent = true;
+
+                    // zeros in castling (common bug)
+                    if(token==QString("0-0")) {
+                        token = QString("O-O");
+                    } else if(token ==QString("0-0-0")) {
+                        token = QString("O-O-O");
+                    }
+                    Move m = this->board->parse_san(token);
+                    this->flushAnnotations();
+                    this->encoder->appendMove(&m);
+                    this->board->make(m);
+                    if(this->varMoves.isEmpty()) {
+                        this->eco.addPly(this->board);
+                    }
+                }
+            }
+            if(readNextLine) {
+                line = in.readLine();
+            }
+        }
+        this->flushAnnotations();
+    } catch(std::invalid_argument a) {
+        this->encoder->endGame();
+        out->resize(start);
+        std::cout << a.what() << std::endl;
+        throw std::invalid_argument("unable to parse game");
+    }
+    return this->encoder->endGame();
+}
@@ -0,0 +1,65 @@
+#ifndef PGN_TRANSCODER_H
+#define PGN_TRANSCODER_H
+
+#include <QTextStream>
+#include <QVector>
+#include "chess/board.h"
+#include "chess/dcgencoder.h"
+#include "chess/ecocode.h"
+
+namespace chess {
+
+// converts PGN games directly into DCG game records. In contrast to
+// PgnReader + DcgEncoder no Game tree is built: a single board is
+// updated move by move with make(), and moves are unmade to jump back
+// when a variation starts or ends. Markers,
+// nags and comments are written in the order they appear in the PGN,
+// which the DcgDecoder replays into exactly the tree PgnReader builds.
+// Like the encoder it wraps, use one instance per thread.
+class PgnTranscoder
+{
+public:
+    PgnTranscoder();
+    ~PgnTranscoder();
+
+    /**
+     * @brief transcodeGame reads the game at the current position of in
+     *        and appends it as DCG record (length prefix and body) to out.
+     *        throws std::invalid_argument if the game can't be parsed
+     *        (out is left unchanged in that case)
+     * @return number of bytes appended
+     */
+    int transcodeGame(QTextStream &in, QByteArray *out);
+
+    /**
+     * @brief transcodeGameFromFile same as transcodeGame, but reads
+     *        the game at offset from the PGN file filename
+     */
+    int transcodeGameFromFile(const QString &filename, const char* encoding,
+                              qint64 offset, QByteArray *out);
+
+    /**
+     * @brief getEcoEntry ECO classification of the main line of the
+     *        last transcoded game, 0 if none of its positions is known
+     */
+    const EcoEntry* getEcoEntry();
+
+private:
+    DcgEncoder *encoder;
+    Board *board;
+    BoardState initialPosition;
+    // moves unmade where a variation was started, and the number
+    // of moves made on the board at that point
+    QVector<Move> varMoves;
+    QVector<int> varDepths;
+    // classifies the main line while it is transcoded
+    EcoClassifier eco;
+    // annotations of the current node that are not yet written
+    QList<int> *pendingNags;
+    QString pendingComment;
+    void flushAnnotations();
+};
+
+}
+
+#endif // PGN_TRANSCODER_H
@@ -8,6 +8,8 @@
 #include "chess/pgn_reader.h"
 #include "chess/dcgencoder.h"
 #include "chess/database.h"
+#include "chess/pgn_exporter.h"
+#include "chess/ecoreclassifier.h"
 
 int main(int argc, char *argv[])
 {
@@ -17,14 +19,17 @@ int main(int argc, char *argv[])
     QCoreApplication::setApplicationVersion("v1.0");
 
     QCommandLineParser parser;
-    parser.setApplicationDescription("pgn2dcg");
+    parser.setApplicationDescription("pgn2dcg\n\n"
+                                     "pgn2dcg -p games.pgn -o database.dcg converts PGN to a database.\n"
+                                     "pgn2dcg export -o database.dcg -p games.pgn writes the games of a database back to PGN.\n"
+                                     "pgn2dcg eco-reclassify -o database.dcg sets the ECO code of each game from its opening.");
     parser.addHelpOption();
     parser.addVersionOption();
     parser.addPositionalArgument("source", QCoreApplication::translate("main", "PGN input file."));
     parser.addPositionalArgument("destination", QCoreApplication::translate("main", "*dc* output files."));
 
     QCommandLineOption pgnFileOption(QStringList() << "p" << "pgn-file",
-              QCoreApplication::translate("main", "PGN input file <games.pgn>."),
+              QCoreApplication::translate("main", "PGN file <games.pgn>, read on import, written on export."),
               QCoreApplication::translate("main", "filename."));
     parser.addOption(pgnFileOption);
 
@@ -37,6 +42,26 @@ int main(int argc, char *argv[])
     QCommandLineOption appendOption("a", QCoreApplication::translate("main", "If database exists, append instead of overwriting"));
     parser.addOption(appendOption);
 
+    QCommandLineOption rangeOption(QStringList() << "r" << "range",
+              QCoreApplication::translate("main", "export: only games <first-last>, counted from 0."),
+              QCoreApplication::translate("main", "range"));
+    parser.addOption(rangeOption);
+
+    QCommandLineOption playerOption(QStringList() << "player",
+              QCoreApplication::translate("main", "export: only games where <name> has white or black."),
+              QCoreApplication::translate("main", "name"));
+    parser.addOption(playerOption);
+
+    QCommandLineOption eventOption(QStringList() << "event",
+              QCoreApplication::translate("main", "export: only games of <event>."),
+              QCoreApplication::translate("main", "event"));
+    parser.addOption(eventOption);
+
+    QCommandLineOption threadsOption(QStringList() << "t" << "threads",
+              QCoreApplication::translate("main", "export, eco-reclassify: number of worker threads."),
+              QCoreApplication::translate("main", "number"));
+    parser.addOption(threadsOption);
+
     parser.process(app);
 
     bool append = parser.isSet(appendOption);
@@ -51,6 +76,62 @@ int main(int argc, char *argv[])
     }
 
     QString pgnFileName = parser.value(pgnFileOption);
+    QString dbFileName = parser.value(dbFileOption);
+    if(dbFileName.endsWith(".dcg") || dbFileName.endsWith(".dci") || dbFileName.endsWith(".dcs")
+            || dbFileName.endsWith(".dcn")) {
+        dbFileName = dbFileName.left(dbFileName.size()-4);
+    }
+
+    if(args.size() > 0 && args.at(0) == "export") {
+        if(dbFileName.isEmpty() || pgnFileName.isEmpty()) {
+            std::cout << "Error: export needs a database (-o) and a PGN output file (-p)." << std::endl;
+            exit(0);
+        }
+        chess::Database *database = new chess::Database(dbFileName);
+        database->loadIndex();
+        database->loadNames();
+        database->loadSites();
+        database->loadEvents();
+        chess::PgnExporter exporter(database);
+        if(parser.isSet(rangeOption)) {
+            QStringList range = parser.value(rangeOption).split("-");
+            int last = range.size() > 1 && !range.at(1).isEmpty() ? range.at(1).toInt() : -1;
+            exporter.setRange(range.at(0).toInt(), last);
+        }
+        exporter.setPlayer(parser.value(playerOption));
+        exporter.setEvent(parser.value(eventOption));
+        if(parser.isSet(threadsOption)) {
+            exporter.setThreads(parser.value(threadsOption).toInt());
+        }
+        int games = exporter.exportGames(pgnFileName);
+        if(games >= 0) {
+            std::cout << "exported " << games << " games" << std::endl;
+        }
+        delete database;
+        return games >= 0 ? 0 : 1;
+    }
+
+    if(args.size() > 0 && args.at(0) == "eco-reclassify") {
+        if(dbFileName.isEmpty()) {
+            std::cout << "Error: eco-reclassify needs a database (-o)." << std::endl;
+            exit(0);
+        }
+        chess::Database *database = new chess::Database(dbFileName);
+        // rolls back an interrupted import first
+        database->loadIndex();
+        chess::EcoReclassifier reclassifier(database);
+        if(parser.isSet(threadsOption)) {
+            reclassifier.setThreads(parser.value(threadsOption).toInt());
+        }
+        int changed = reclassifier.reclassify();
+        if(changed >= 0) {
+            std::cout << "reclassified " << reclassifier.getGames() << " games, "
+                      << changed << " got a new ECO code" << std::endl;
+        }
+        delete database;
+        return changed >= 0 ? 0 : 1;
+    }
+
     QFile pgnFile;
     pgnFile.setFileName(pgnFileName);
     if(!pgnFile.exists()) {
@@ -64,11 +145,6 @@ int main(int argc, char *argv[])
         exit(0);
     }
 
-    QString dbFileName = parser.value(dbFileOption);
-    if(dbFileName.endsWith(".dcg") || dbFileName.endsWith(".dci") || dbFileName.endsWith(".dcs")
-            || dbFileName.endsWith(".dcn")) {
-        dbFileName = dbFileName.left(dbFileName.size()-4);
-    }
     if(dbFileName.isEmpty()) {
         std::cout << "Error: no output Database filename given." << std::endl;
         exit(0);
@@ -25,10 +25,19 @@ SOURCES += main.cpp \
     chess/dcgencoder.cpp \
     chess/byteutil.cpp \
     chess/dcgdecoder.cpp \
-    chess/indexentry.cpp
+    chess/indexentry.cpp \
+    chess/pgn_transcoder.cpp \
+    chess/arena.cpp \
+    chess/flat_game.cpp \
+    chess/gamecursor.cpp \
+    chess/batchfetch.cpp \
+    chess/importjournal.cpp \
+    chess/pgn_exporter.cpp \
+    chess/ecoreclassifier.cpp
 
 HEADERS += \
     chess/board.h \
+    chess/board_tables.h \
     chess/ecocode.h \
     chess/game.h \
     chess/game_node.h \
@@ -43,4 +52,12 @@ HEADERS += \
     chess/dcgencoder.h \
     chess/byteutil.h \
     chess/dcgdecoder.h \
-    chess/indexentry.h
+    chess/indexentry.h \
+    chess/pgn_transcoder.h \
+    chess/arena.h \
+    chess/flat_game.h \
+    chess/gamecursor.h \
+    chess/batchfetch.h \
+    chess/importjournal.h \
+    chess/pgn_exporter.h \
+    chess/ecoreclassifier.h